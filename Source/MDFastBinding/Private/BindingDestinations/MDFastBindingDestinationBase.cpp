@@ -2,14 +2,16 @@
 
 #include "BindingDestinations/MDFastBindingDestinationBase.h"
 
+#include "MDFastBindingAsyncLoader.h"
 #include "MDFastBindingInstance.h"
+#include "MDFastBindingTrace.h"
 #include "BindingValues/MDFastBindingValueBase.h"
 #include "Misc/App.h"
 
 void UMDFastBindingDestinationBase::InitializeDestination(UObject* SourceObject)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetName());
+	MDFASTBINDING_TRACE_SCOPE(GetTraceSpecId());
 	InitializeDestination_Internal(SourceObject);
 
 	for (FMDFastBindingItem& BindingItem : BindingItems)
@@ -25,25 +27,39 @@ void UMDFastBindingDestinationBase::InitializeDestination(UObject* SourceObject)
 			BindingItem.GetValue(SourceObject, bDidUpdate);
 		}
 	}
+
+	InitializeDirtyPropagation();
 }
 
 void UMDFastBindingDestinationBase::UpdateDestination(UObject* SourceObject)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetName());
+	MDFASTBINDING_TRACE_SCOPE(GetTraceSpecId());
+
+	PollInputs(SourceObject);
+
 	if (CheckCachedNeedsUpdate())
 	{
 #if WITH_EDITORONLY_DATA
 		LastTimeNodeRan = FApp::GetCurrentTime();
+		FMDFastBindingNodeStatsScope StatsScope(NodeStats);
 #endif
+		BeginUpdate();
+
+		FMDFastBindingAsyncLoadRequesterScope AsyncLoadScope(this);
 		UpdateDestination_Internal(SourceObject);
+
+		if (HasRunSuccessfully())
+		{
+			MarkObjectClean();
+		}
 	}
 }
 
 void UMDFastBindingDestinationBase::TerminateDestination(UObject* SourceObject)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetName());
+	MDFASTBINDING_TRACE_SCOPE(GetTraceSpecId());
 	TerminateDestination_Internal(SourceObject);
 
 	for (const FMDFastBindingItem& BindingItem : BindingItems)
@@ -3,6 +3,7 @@
 #include "BindingDestinations/MDFastBindingDestination_Function.h"
 
 #include "MDFastBinding.h"
+#include "MDFastBindingCostEstimate.h"
 
 #define LOCTEXT_NAMESPACE "MDFastBindingDestination_Function"
 
@@ -142,6 +143,13 @@ void UMDFastBindingDestination_Function::PostInitProperties()
 	Super::PostInitProperties();
 }
 
+void UMDFastBindingDestination_Function::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	Super::AccumulateAllocatedMemory(InOutMemory);
+
+	Function.AccumulateAllocatedMemory(InOutMemory);
+}
+
 bool UMDFastBindingDestination_Function::ShouldCallFunction()
 {
 	const bool bResult = UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded || bNeedsUpdate || !HasEverUpdated();
@@ -230,6 +238,13 @@ void UMDFastBindingDestination_Function::SetFunction(UFunction* Func, UClass* Sc
 	Function.FunctionMember.bIsFunction = true;
 	Function.FunctionMember.SetFromField<UFunction>(Func, IsValid(Scope), Scope);
 }
+
+void UMDFastBindingDestination_Function::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	++InOutCost.NumFunctionCalls;
+}
 #endif
 
 #if WITH_EDITORONLY_DATA
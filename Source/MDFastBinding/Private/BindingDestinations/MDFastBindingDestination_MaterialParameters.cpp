@@ -0,0 +1,228 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "BindingDestinations/MDFastBindingDestination_MaterialParameters.h"
+
+#include "Engine/Texture.h"
+#include "MDFastBinding.h"
+#include "MDFastBindingCostEstimate.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingDestination_MaterialParameters"
+
+namespace MDFastBindingDestination_MaterialParameters_Private
+{
+	const FName MaterialName = TEXT("Material");
+
+	const FProperty* GetParameterValueProperty(EMDFastBindingMaterialParameterType ParameterType)
+	{
+		static const FProperty* ScalarProp = UMDFastBindingDestination_MaterialParameters::StaticClass()->FindPropertyByName(TEXT("ScalarProperty"));
+		static const FProperty* VectorProp = UMDFastBindingDestination_MaterialParameters::StaticClass()->FindPropertyByName(TEXT("VectorProperty"));
+		static const FProperty* TextureProp = UMDFastBindingDestination_MaterialParameters::StaticClass()->FindPropertyByName(TEXT("TextureProperty"));
+
+		switch (ParameterType)
+		{
+		case EMDFastBindingMaterialParameterType::Vector:
+			return VectorProp;
+		case EMDFastBindingMaterialParameterType::Texture:
+			return TextureProp;
+		default:
+			return ScalarProp;
+		}
+	}
+}
+
+void UMDFastBindingDestination_MaterialParameters::InitializeDestination_Internal(UObject* SourceObject)
+{
+	Super::InitializeDestination_Internal(SourceObject);
+
+	BindMaterial(nullptr);
+}
+
+void UMDFastBindingDestination_MaterialParameters::UpdateDestination_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> MaterialValue = GetBindingItemValue(SourceObject, MDFastBindingDestination_MaterialParameters_Private::MaterialName, bDidUpdate);
+	UMaterialInstanceDynamic* Material = MaterialValue.Value != nullptr && CastField<const FObjectPropertyBase>(MaterialValue.Key) != nullptr
+		? Cast<UMaterialInstanceDynamic>(*static_cast<UObject**>(MaterialValue.Value))
+		: nullptr;
+	if (Material == nullptr)
+	{
+		return;
+	}
+
+	// Parameter indices are only valid for the material they were resolved on
+	if (Material != BoundMaterial.Get() || ParameterStates.Num() != Parameters.Num())
+	{
+		BindMaterial(Material);
+	}
+
+	for (int32 i = 0; i < Parameters.Num(); ++i)
+	{
+		const TTuple<const FProperty*, void*> Value = GetBindingItemValue(SourceObject, Parameters[i].ParameterName, bDidUpdate);
+		if (Value.Key != nullptr && Value.Value != nullptr)
+		{
+			PushParameter(*Material, Parameters[i], ParameterStates[i], Value.Key, Value.Value);
+		}
+	}
+
+	MarkAsHasEverUpdated();
+}
+
+void UMDFastBindingDestination_MaterialParameters::TerminateDestination_Internal(UObject* SourceObject)
+{
+	Super::TerminateDestination_Internal(SourceObject);
+
+	BindMaterial(nullptr);
+}
+
+void UMDFastBindingDestination_MaterialParameters::BindMaterial(UMaterialInstanceDynamic* Material)
+{
+	BoundMaterial = Material;
+
+	ParameterStates.Reset();
+	ParameterStates.SetNum(Parameters.Num());
+}
+
+void UMDFastBindingDestination_MaterialParameters::PushParameter(UMaterialInstanceDynamic& Material, const FMDFastBindingMaterialParameter& Parameter, FParameterState& State, const FProperty* ValueProp, const void* ValuePtr)
+{
+	if (State.bIsMissing)
+	{
+		return;
+	}
+
+	const FProperty* ParameterProp = MDFastBindingDestination_MaterialParameters_Private::GetParameterValueProperty(Parameter.ParameterType);
+
+	switch (Parameter.ParameterType)
+	{
+	case EMDFastBindingMaterialParameterType::Scalar:
+		{
+			float Value = 0.f;
+			FMDFastBindingModule::SetPropertyDirectly(ParameterProp, &Value, ValueProp, ValuePtr);
+			if (State.bHasValue && State.ScalarValue == Value)
+			{
+				return;
+			}
+
+			if (State.ParameterIndex == INDEX_NONE || !Material.SetScalarParameterByIndex(State.ParameterIndex, Value))
+			{
+				State.bIsMissing = !Material.InitializeScalarParameterAndGetIndex(Parameter.ParameterName, Value, State.ParameterIndex);
+			}
+
+			State.ScalarValue = Value;
+			break;
+		}
+	case EMDFastBindingMaterialParameterType::Vector:
+		{
+			FLinearColor Value = FLinearColor::Black;
+			FMDFastBindingModule::SetPropertyDirectly(ParameterProp, &Value, ValueProp, ValuePtr);
+			if (State.bHasValue && State.VectorValue == Value)
+			{
+				return;
+			}
+
+			if (State.ParameterIndex == INDEX_NONE || !Material.SetVectorParameterByIndex(State.ParameterIndex, Value))
+			{
+				State.bIsMissing = !Material.InitializeVectorParameterAndGetIndex(Parameter.ParameterName, Value, State.ParameterIndex);
+			}
+
+			State.VectorValue = Value;
+			break;
+		}
+	case EMDFastBindingMaterialParameterType::Texture:
+		{
+			UTexture* Value = nullptr;
+			FMDFastBindingModule::SetPropertyDirectly(ParameterProp, &Value, ValueProp, ValuePtr);
+			if (State.bHasValue && State.TextureValue.Get() == Value)
+			{
+				return;
+			}
+
+			Material.SetTextureParameterValue(Parameter.ParameterName, Value);
+			State.TextureValue = Value;
+			break;
+		}
+	}
+
+	State.bHasValue = true;
+}
+
+void UMDFastBindingDestination_MaterialParameters::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	TSet<FName> ExpectedInputs = { MDFastBindingDestination_MaterialParameters_Private::MaterialName };
+	for (const FMDFastBindingMaterialParameter& Parameter : Parameters)
+	{
+		ExpectedInputs.Add(Parameter.ParameterName);
+	}
+
+	for (int32 i = BindingItems.Num() - 1; i >= 0; --i)
+	{
+		if (!ExpectedInputs.Contains(BindingItems[i].ItemName))
+		{
+#if WITH_EDITORONLY_DATA
+			if (BindingItems[i].Value != nullptr)
+			{
+				OrphanBindingItem(BindingItems[i].Value);
+			}
+#endif
+			BindingItems.RemoveAt(i);
+		}
+	}
+
+	EnsureBindingItemExists(MDFastBindingDestination_MaterialParameters_Private::MaterialName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_MaterialParameters, MaterialProperty))
+		, LOCTEXT("MaterialToolTip", "The dynamic material instance to set the parameters on"));
+
+	for (const FMDFastBindingMaterialParameter& Parameter : Parameters)
+	{
+		if (Parameter.ParameterName == NAME_None || Parameter.ParameterName == MDFastBindingDestination_MaterialParameters_Private::MaterialName)
+		{
+			continue;
+		}
+
+		EnsureBindingItemExists(Parameter.ParameterName
+			, MDFastBindingDestination_MaterialParameters_Private::GetParameterValueProperty(Parameter.ParameterType)
+			, FText::Format(LOCTEXT("ParameterToolTip", "The value to set the material parameter [{0}] to"), FText::FromName(Parameter.ParameterName)));
+	}
+}
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingDestination_MaterialParameters::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	TSet<FName> ParameterNames;
+	for (const FMDFastBindingMaterialParameter& Parameter : Parameters)
+	{
+		if (Parameter.ParameterName == NAME_None)
+		{
+			ValidationErrors.Add(LOCTEXT("EmptyParameterName", "Material parameters must have a name"));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (Parameter.ParameterName == MDFastBindingDestination_MaterialParameters_Private::MaterialName)
+		{
+			ValidationErrors.Add(FText::Format(LOCTEXT("ReservedParameterName", "[{0}] is reserved for the material input, rename the parameter"), FText::FromName(Parameter.ParameterName)));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (ParameterNames.Contains(Parameter.ParameterName))
+		{
+			ValidationErrors.Add(FText::Format(LOCTEXT("DuplicateParameterName", "The material parameter [{0}] is set more than once"), FText::FromName(Parameter.ParameterName)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		ParameterNames.Add(Parameter.ParameterName);
+	}
+
+	return Result;
+}
+
+void UMDFastBindingDestination_MaterialParameters::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	InOutCost.NumSetterCalls += Parameters.Num();
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
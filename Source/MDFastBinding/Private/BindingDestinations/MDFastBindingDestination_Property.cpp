@@ -9,7 +9,9 @@
 #include "FieldNotification/IFieldValueChanged.h"
 #endif
 #include "MDFastBinding.h"
+#include "MDFastBindingCostEstimate.h"
 #include "MDFastBindingFieldPath.h"
+#include "MDFastBindingWidgetUpdateBatch.h"
 
 #define LOCTEXT_NAMESPACE "MDFastBindingDestination_Property"
 
@@ -73,9 +75,27 @@ void UMDFastBindingDestination_Property::UpdateDestination_Internal(UObject* Sou
 		}
 
 		// Check identical before setting the new value below
-		const bool bShouldBroadcastField = BoundFieldId.IsValid() && (!HasEverUpdated() || !Property.Key->Identical(Property.Value, Value.Value));
+		const bool bIsIdentical = Property.Key->SameType(Value.Key) && Property.Key->Identical(Property.Value, Value.Value);
 
-		FMDFastBindingModule::SetPropertyInContainer(Property.Key, PropertyContainer, Value.Key, Value.Value);
+		// Without a setter, writing a value the property already holds changes nothing, so skip copying it (eg. large structs).
+		// Setters may do more than store the value (broadcast events, invalidate), so they're still called every update.
+		if (bIsIdentical && HasEverUpdated() && !Property.Key->HasSetter())
+		{
+			return;
+		}
+
+		bool bShouldBroadcastField = BoundFieldId.IsValid() && (!HasEverUpdated() || !bIsIdentical);
+
+		// Widget setters are deferred to the end of the update pass, which also broadcasts the field once the setter is called
+		UObject* PropertyOwnerObject = Property.Key->GetOwner<UClass>() != nullptr ? static_cast<UObject*>(PropertyContainer) : nullptr;
+		if (FMDFastBindingWidgetUpdateBatch::TrySetWidgetProperty(PropertyOwnerObject, Property.Key, Value.Key, Value.Value, bShouldBroadcastField ? BoundFieldId : UE::FieldNotification::FFieldId()))
+		{
+			bShouldBroadcastField = false;
+		}
+		else
+		{
+			FMDFastBindingModule::SetPropertyInContainer(Property.Key, PropertyContainer, Value.Key, Value.Value);
+		}
 
 #if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
 		if (bShouldBroadcastField)
@@ -99,6 +119,13 @@ void UMDFastBindingDestination_Property::PostInitProperties()
 	Super::PostInitProperties();
 }
 
+void UMDFastBindingDestination_Property::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	Super::AccumulateAllocatedMemory(InOutMemory);
+
+	PropertyPath.AccumulateAllocatedMemory(InOutMemory);
+}
+
 void* UMDFastBindingDestination_Property::GetPropertyOwner(UObject* SourceObject)
 {
 	FMDFastBindingItem* PathRootItem = FindBindingItem(MDFastBindingDestination_Property_Private::PathRootName);
@@ -110,11 +137,17 @@ void* UMDFastBindingDestination_Property::GetPropertyOwner(UObject* SourceObject
 	bool bDidUpdate = false;
 	const TTuple<const FProperty*, void*> PathRoot = PathRootItem->GetValue(SourceObject, bDidUpdate);
 	bNeedsUpdate = bDidUpdate;
-	if (PathRoot.Key != nullptr && (PathRoot.Key->IsA<FObjectPropertyBase>() || PathRoot.Key->IsA<FStructProperty>()))
+	if (PathRoot.Key != nullptr && PathRoot.Key->IsA<FObjectPropertyBase>())
 	{
 		return PathRoot.Value;
 	}
 
+	if (PathRoot.Key != nullptr && PathRoot.Key->IsA<FStructProperty>())
+	{
+		// A struct without a value input is the item's default, which may be shared with other items so it's never written to
+		return PathRootItem->Value != nullptr ? PathRoot.Value : nullptr;
+	}
+
 	if (PathRootItem->Value != nullptr)
 	{
 		// invalid value, but there's a value input so it failed to get a value, just return null as the owner
@@ -211,6 +244,26 @@ TArray<FFieldVariant> UMDFastBindingDestination_Property::GetFieldPath()
 {
 	return PropertyPath.GetFieldPath();
 }
+
+FString UMDFastBindingDestination_Property::GetDestinationKey() const
+{
+	// Only properties on the widget itself are the same destination across classes
+	const FMDFastBindingItem* PathRootItem = FindBindingItem(MDFastBindingDestination_Property_Private::PathRootName);
+	if (PathRootItem != nullptr && PathRootItem->Value != nullptr)
+	{
+		return {};
+	}
+
+	return PropertyPath.ToString();
+}
+
+void UMDFastBindingDestination_Property::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	InOutCost.AddPath(PropertyPath.GetFieldPath());
+	++InOutCost.NumSetterCalls;
+}
 #endif
 
 #if WITH_EDITORONLY_DATA
@@ -2,16 +2,32 @@
 
 #include "BindingValues/MDFastBindingValueBase.h"
 
+#include "MDFastBindingAsyncLoader.h"
+#include "MDFastBindingCostEstimate.h"
+#include "MDFastBindingHelpers.h"
+#include "MDFastBindingMemoryReport.h"
+#include "MDFastBindingStats.h"
+#include "MDFastBindingTrace.h"
 #include "Misc/App.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
 
 void UMDFastBindingValueBase::BeginDestroy()
 {
 	Super::BeginDestroy();
 
-	if (HasCachedValue())
+	ReleaseCachedValue();
+}
+
+void UMDFastBindingValueBase::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	// Borrowed values are kept alive by the object that owns them
+	UMDFastBindingValueBase* This = CastChecked<UMDFastBindingValueBase>(InThis);
+	if (This->bCachedValueHasObjectReferences && !This->bIsCachedValueBorrowed)
 	{
-		FMemory::Free(CachedValue.Value);
-		CachedValue.Value = nullptr;
+		FMDFastBindingHelpers::AddReferencedObjectsInValue(Collector, This->CachedValue.Key, This->CachedValue.Value, This);
 	}
 }
 
@@ -33,6 +49,7 @@ void UMDFastBindingValueBase::InitializeValue(UObject* SourceObject)
 		}
 	}
 
+	InitializeDirtyPropagation();
 	InitializeValue_Internal(SourceObject);
 }
 
@@ -52,41 +69,192 @@ void UMDFastBindingValueBase::TerminateValue(UObject* SourceObject)
 TTuple<const FProperty*, void*> UMDFastBindingValueBase::GetValue(UObject* SourceObject, bool& OutDidUpdate)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetName());
+	MDFASTBINDING_TRACE_SCOPE(GetTraceSpecId());
 
 	OutDidUpdate = false;
 
-	if (CheckCachedNeedsUpdate())
+	PollInputs(SourceObject);
+
+	// A borrowed value points into memory we don't own, so it needs to be refreshed if that memory may have gone away
+	if (CheckCachedNeedsUpdate() || (bIsCachedValueBorrowed && !IsBorrowedValueValid()))
 	{
 #if WITH_EDITORONLY_DATA
 		LastTimeNodeRan = FApp::GetCurrentTime();
+		FMDFastBindingNodeStatsScope StatsScope(NodeStats);
+#endif
+		BeginUpdate();
+
+		FMDFastBindingAsyncLoadRequesterScope AsyncLoadScope(this);
+
+		TTuple<const FProperty*, void*> BorrowedValue;
+		bool bDidChange = false;
+		UObject* ValueOwner = nullptr;
+		bool bIsReplayingValue = false;
+		TTuple<const FProperty*, void*> ReplayValue;
+#if MDFASTBINDING_RECORDING_ENABLED
+		bIsReplayingValue = FMDFastBindingReplay::IsReplaying() && FMDFastBindingReplay::FindValueOverride(*this, ReplayValue);
 #endif
-		const TTuple<const FProperty*, void*> Value = GetValue_Internal(SourceObject);
-		if (Value.Key == nullptr || Value.Value == nullptr)
+		if (!bIsReplayingValue && GetBorrowedValue_Internal(SourceObject, BorrowedValue, bDidChange, ValueOwner))
 		{
-			return Value;
-		}
+			if (BorrowedValue.Key == nullptr || BorrowedValue.Value == nullptr || ValueOwner == nullptr)
+			{
+				if (bIsCachedValueBorrowed)
+				{
+					ReleaseCachedValue();
+				}
+
+				// Keep trying on later updates
+				MarkPathDirty();
+				return {};
+			}
+
+			OutDidUpdate = bDidChange || !bIsCachedValueBorrowed || CachedValue.Key != BorrowedValue.Key || CachedValue.Value != BorrowedValue.Value;
+			if (!bIsCachedValueBorrowed)
+			{
+				ReleaseCachedValue();
+			}
 
-		if (CachedValue.Key == nullptr || CachedValue.Value == nullptr)
+			CachedValue = BorrowedValue;
+			bIsCachedValueBorrowed = true;
+			BorrowedValueOwner = ValueOwner;
+
+			const UMDFastBindingValueBase* OwnerValue = Cast<UMDFastBindingValueBase>(ValueOwner);
+			BorrowedValueOwnerVersion = OwnerValue != nullptr ? OwnerValue->ValueVersion : 0;
+		}
+		else
 		{
-			CachedValue.Key = Value.Key;
-			CachedValue.Value = FMemory::Malloc(CachedValue.Key->GetSize(), CachedValue.Key->GetMinAlignment());
-			CachedValue.Key->InitializeValue(CachedValue.Value);
-			CachedValue.Key->CopyCompleteValue(CachedValue.Value, Value.Value);
-			OutDidUpdate = true;
+			const TTuple<const FProperty*, void*> Value = bIsReplayingValue ? ReplayValue : GetValue_Internal(SourceObject);
+			if (Value.Key == nullptr || Value.Value == nullptr)
+			{
+				if (bIsCachedValueBorrowed)
+				{
+					ReleaseCachedValue();
+				}
+
+				MarkPathDirty();
+				return Value;
+			}
+
+			// Covers the copies below too, they can allocate for strings and containers
+			LLM_SCOPE_BYTAG(MDFastBinding);
+
+			// Switching from a borrowed value or to a different type needs a new allocation
+			if (bIsCachedValueBorrowed || CachedValue.Key != Value.Key)
+			{
+				ReleaseCachedValue();
+			}
+
+			if (CachedValue.Key == nullptr || CachedValue.Value == nullptr)
+			{
+				CachedValue.Key = Value.Key;
+				CachedValue.Value = FMemory::Malloc(CachedValue.Key->GetSize(), CachedValue.Key->GetMinAlignment());
+				CachedValue.Key->InitializeValue(CachedValue.Value);
+				CachedValue.Key->CopyCompleteValue(CachedValue.Value, Value.Value);
+				OutDidUpdate = true;
+
+				TArray<const FStructProperty*> EncounteredStructProps;
+				bCachedValueHasObjectReferences = CachedValue.Key->ContainsObjectReference(EncounteredStructProps);
+			}
+			else if (!CachedValue.Key->Identical(CachedValue.Value, Value.Value))
+			{
+				CachedValue.Key->CopyCompleteValue(CachedValue.Value, Value.Value);
+				OutDidUpdate = true;
+			}
 		}
-		else if (!CachedValue.Key->Identical(CachedValue.Value, Value.Value))
+
+		if (OutDidUpdate)
 		{
-			CachedValue.Key->CopyCompleteValue(CachedValue.Value, Value.Value);
-			OutDidUpdate = true;
+			++ValueVersion;
+#if WITH_EDITORONLY_DATA
+			StatsScope.MarkChanged();
+#endif
+#if MDFASTBINDING_RECORDING_ENABLED
+			if (FMDFastBindingRecorder::IsRecording())
+			{
+				FMDFastBindingRecorder::RecordValue(*this);
+			}
+#endif
 		}
 
 		MarkObjectClean();
+
+		if (UpdateType == EMDFastBindingUpdateType::Always || bUpdateWhenInputsArePolled)
+		{
+			FinishPolledUpdate(OutDidUpdate);
+		}
 	}
 
 	return CachedValue;
 }
 
+#if WITH_EDITOR
+void UMDFastBindingValueBase::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	// Containers and strings allocate when copied into the cached value
+	const FProperty* OutputProp = GetOutputProperty();
+	if (OutputProp != nullptr && (OutputProp->IsA<FArrayProperty>() || OutputProp->IsA<FSetProperty>() || OutputProp->IsA<FMapProperty>()
+		|| OutputProp->IsA<FStrProperty>() || OutputProp->IsA<FTextProperty>()))
+	{
+		++InOutCost.NumContainerCopies;
+	}
+}
+#endif
+
+TTuple<const FProperty*, void*> UMDFastBindingValueBase::GetCachedValue() const
+{
+	if (bIsCachedValueBorrowed && !IsBorrowedValueValid())
+	{
+		return {};
+	}
+
+	return CachedValue;
+}
+
+void UMDFastBindingValueBase::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	Super::AccumulateAllocatedMemory(InOutMemory);
+
+	// Borrowed values are owned by someone else
+	if (!bIsCachedValueBorrowed)
+	{
+		InOutMemory.AddPropertyValue(CachedValue.Key, CachedValue.Value);
+	}
+}
+
+bool UMDFastBindingValueBase::IsBorrowedValueValid() const
+{
+	const UObject* Owner = BorrowedValueOwner.Get();
+	if (Owner == nullptr)
+	{
+		return false;
+	}
+
+	// Values borrowed from another node are only valid until that node updates its value
+	if (const UMDFastBindingValueBase* OwnerValue = Cast<UMDFastBindingValueBase>(Owner))
+	{
+		return OwnerValue == this || (OwnerValue->HasCachedValue() && OwnerValue->ValueVersion == BorrowedValueOwnerVersion);
+	}
+
+	return true;
+}
+
+void UMDFastBindingValueBase::ReleaseCachedValue()
+{
+	if (!bIsCachedValueBorrowed && CachedValue.Key != nullptr && CachedValue.Value != nullptr)
+	{
+		CachedValue.Key->DestroyValue(CachedValue.Value);
+		FMemory::Free(CachedValue.Value);
+	}
+
+	CachedValue = {};
+	bIsCachedValueBorrowed = false;
+	bCachedValueHasObjectReferences = false;
+	BorrowedValueOwner.Reset();
+	BorrowedValueOwnerVersion = 0;
+}
+
 const FMDFastBindingItem* UMDFastBindingValueBase::GetOwningBindingItem() const
 {
 	if (const UMDFastBindingObject* OuterObject = Cast<UMDFastBindingObject>(GetOuter()))
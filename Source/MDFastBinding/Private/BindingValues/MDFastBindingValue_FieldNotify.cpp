@@ -58,6 +58,29 @@ TTuple<const FProperty*, void*> UMDFastBindingValue_FieldNotify::GetValue_Intern
 	return Super::GetValue_Internal(SourceObject);
 }
 
+bool UMDFastBindingValue_FieldNotify::GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner)
+{
+	UObject* PropertyOwner = GetUObjectPropertyOwner(SourceObject);
+	if (Cast<INotifyFieldValueChanged>(PropertyOwner) != BoundInterface.Get())
+	{
+		BindFieldNotify(SourceObject);
+	}
+
+	// Without a bound field we'd need a copy to know when the value changes
+	if (!BoundFieldId.IsValid())
+	{
+		return false;
+	}
+
+	// The value can only have changed if we were notified, a new owner shows up as a different value pointer
+	OutValue = Super::GetValue_Internal(SourceObject);
+	OutDidChange = IsObjectDirty();
+	// Getter results are stored in our property path, properties are read in place on their owner
+	OutValueOwner = PropertyPath.IsLeafFunction() ? this : PropertyOwner;
+
+	return true;
+}
+
 void UMDFastBindingValue_FieldNotify::TerminateValue_Internal(UObject* SourceObject)
 {
 	Super::TerminateValue_Internal(SourceObject);
@@ -72,7 +95,8 @@ const FProperty* UMDFastBindingValue_FieldNotify::GetPathRootProperty() const
 
 void UMDFastBindingValue_FieldNotify::OnFieldNotifyValueChanged(UObject* Object, UE::FieldNotification::FFieldId FieldId)
 {
-	MarkObjectDirty();
+	// Field notifications can be broadcast from worker threads
+	MarkObjectDirty_AnyThread();
 }
 
 bool UMDFastBindingValue_FieldNotify::IsValidFieldNotify(const FFieldVariant& Field) const
@@ -3,6 +3,7 @@
 #include "BindingValues/MDFastBindingValue_FormatText.h"
 
 #include "MDFastBinding.h"
+#include "MDFastBindingCostEstimate.h"
 
 TTuple<const FProperty*, void*> UMDFastBindingValue_FormatText::GetValue_Internal(UObject* SourceObject)
 {
@@ -114,3 +115,12 @@ void UMDFastBindingValue_FormatText::SetupBindingItems()
 		EnsureBindingItemExists(Arg, GetOutputProperty(), FText::GetEmpty()).ForceDisplayItemName();
 	}
 }
+
+#if WITH_EDITOR
+void UMDFastBindingValue_FormatText::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	++InOutCost.NumTextFormats;
+}
+#endif
@@ -3,6 +3,7 @@
 #include "BindingValues/MDFastBindingValue_Function.h"
 
 #include "MDFastBinding.h"
+#include "MDFastBindingCostEstimate.h"
 #include "BindingDestinations/MDFastBindingDestinationBase.h"
 
 #define LOCTEXT_NAMESPACE "MDFastBindingDestination_Function"
@@ -210,6 +211,13 @@ void UMDFastBindingValue_Function::PostInitProperties()
 	Super::PostInitProperties();
 }
 
+void UMDFastBindingValue_Function::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	Super::AccumulateAllocatedMemory(InOutMemory);
+
+	Function.AccumulateAllocatedMemory(InOutMemory);
+}
+
 bool UMDFastBindingValue_Function::ShouldCallFunction()
 {
 	return UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded || bNeedsUpdate || !HasCachedValue();
@@ -246,6 +254,13 @@ void UMDFastBindingValue_Function::OnVariableRenamed(UClass* VariableClass, cons
 	Function.OnVariableRenamed(VariableClass, OldVariableName, NewVariableName);
 }
 
+void UMDFastBindingValue_Function::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	++InOutCost.NumFunctionCalls;
+}
+
 UFunction* UMDFastBindingValue_Function::GetFunction()
 {
 	return Function.GetFunctionPtr();
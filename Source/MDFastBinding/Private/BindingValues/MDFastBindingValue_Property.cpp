@@ -2,6 +2,7 @@
 
 #include "BindingValues/MDFastBindingValue_Property.h"
 
+#include "MDFastBindingCostEstimate.h"
 #include "MDFastBindingFieldPath.h"
 
 #define LOCTEXT_NAMESPACE "MDFastBindingValue_Property"
@@ -11,11 +12,40 @@ namespace MDFastBindingValue_Property_Private
 	const FName PathRootName = TEXT("Path Root");
 }
 
+void UMDFastBindingValue_Property::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	bCanBorrowFromPathRoot = CanBorrowFromPathRoot();
+}
+
 TTuple<const FProperty*, void*> UMDFastBindingValue_Property::GetValue_Internal(UObject* SourceObject)
 {
 	return PropertyPath.ResolvePath(SourceObject);
 }
 
+bool UMDFastBindingValue_Property::GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner)
+{
+	if (!bCanBorrowFromPathRoot)
+	{
+		return false;
+	}
+
+	UMDFastBindingValueBase* PathRootValue = GetPathRootValue();
+	if (PathRootValue == nullptr)
+	{
+		return false;
+	}
+
+	// Resolving the path updates the path root node, our value can only have changed if its value did
+	OutValue = PropertyPath.ResolvePath(SourceObject);
+	OutDidChange = PathRootValue->GetValueVersion() != BorrowedPathRootVersion;
+	OutValueOwner = PathRootValue;
+	BorrowedPathRootVersion = PathRootValue->GetValueVersion();
+
+	return true;
+}
+
 const FProperty* UMDFastBindingValue_Property::GetOutputProperty()
 {
 	return PropertyPath.GetLeafProperty();
@@ -114,11 +144,47 @@ void UMDFastBindingValue_Property::PostInitProperties()
 	Super::PostInitProperties();
 }
 
+void UMDFastBindingValue_Property::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	Super::AccumulateAllocatedMemory(InOutMemory);
+
+	PropertyPath.AccumulateAllocatedMemory(InOutMemory);
+}
+
 FFieldVariant UMDFastBindingValue_Property::GetLeafField()
 {
 	return PropertyPath.GetLeafField();
 }
 
+UMDFastBindingValueBase* UMDFastBindingValue_Property::GetPathRootValue() const
+{
+	const FMDFastBindingItem* PathRootItem = FindBindingItem(MDFastBindingValue_Property_Private::PathRootName);
+	return PathRootItem != nullptr ? PathRootItem->Value : nullptr;
+}
+
+bool UMDFastBindingValue_Property::CanBorrowFromPathRoot()
+{
+	// Object properties can be changed by anything without us knowing, so only struct values output by another node can be borrowed from
+	const UMDFastBindingValueBase* PathRootValue = GetPathRootValue();
+	if (PathRootValue == nullptr || CastField<const FStructProperty>(GetBindingItemValueProperty(MDFastBindingValue_Property_Private::PathRootName)) == nullptr)
+	{
+		return false;
+	}
+
+	// Getter results are overwritten by the next call and object members live outside of the path root's value
+	const TArray<FFieldVariant> Path = PropertyPath.GetFieldPath();
+	for (int32 i = 0; i < Path.Num(); ++i)
+	{
+		const FProperty* Prop = CastField<const FProperty>(Path[i].ToField());
+		if (Prop == nullptr || (i < Path.Num() - 1 && !Prop->IsA<FStructProperty>()))
+		{
+			return false;
+		}
+	}
+
+	return !Path.IsEmpty();
+}
+
 #if WITH_EDITOR
 EDataValidationResult UMDFastBindingValue_Property::IsDataValid(TArray<FText>& ValidationErrors)
 {
@@ -172,6 +238,13 @@ TArray<FFieldVariant> UMDFastBindingValue_Property::GetFieldPath()
 {
 	return PropertyPath.GetFieldPath();
 }
+
+void UMDFastBindingValue_Property::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	Super::AccumulateEstimatedCost(InOutCost);
+
+	InOutCost.AddPath(PropertyPath.GetFieldPath());
+}
 #endif
 
 #undef LOCTEXT_NAMESPACE
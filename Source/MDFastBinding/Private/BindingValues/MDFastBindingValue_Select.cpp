@@ -30,12 +30,46 @@ bool UMDFastBindingValue_Select::HasUserExtendablePinList() const
 }
 
 TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UObject* SourceObject)
+{
+	const FName ResultItemName = FindSelectedItemName(SourceObject);
+	if (ResultItemName == NAME_None)
+	{
+		return {};
+	}
+
+	bool bDidUpdate = false;
+	return GetBindingItemValue(SourceObject, ResultItemName, bDidUpdate);
+}
+
+bool UMDFastBindingValue_Select::GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner)
+{
+	// The selected value is already cached by its own node, so pass it through instead of copying it again
+	const FName ResultItemName = FindSelectedItemName(SourceObject);
+	FMDFastBindingItem* ResultItem = ResultItemName != NAME_None ? FindBindingItem(ResultItemName) : nullptr;
+	if (ResultItem == nullptr)
+	{
+		SelectedItemName = NAME_None;
+		OutValue = {};
+		return true;
+	}
+
+	bool bDidUpdate = false;
+	OutValue = ResultItem->GetValue(SourceObject, bDidUpdate);
+	OutDidChange = bDidUpdate || ResultItemName != SelectedItemName;
+	// Default values are stored on our binding items
+	OutValueOwner = ResultItem->Value != nullptr ? static_cast<UObject*>(ResultItem->Value.Get()) : this;
+	SelectedItemName = ResultItemName;
+
+	return true;
+}
+
+FName UMDFastBindingValue_Select::FindSelectedItemName(UObject* SourceObject)
 {
 	bool bDidUpdate = false;
 	TTuple<const FProperty*, void*> InputValue = GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::SelectValueInputName, bDidUpdate);
 	if (InputValue.Key == nullptr || InputValue.Value == nullptr)
 	{
-		return {};
+		return NAME_None;
 	}
 
 	if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(InputValue.Key))
@@ -43,11 +77,11 @@ TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UO
 		static const bool TrueValue = true;
 		if (BoolProp->Identical(&TrueValue, InputValue.Value, 0))
 		{
-			return GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::TrueItemName, bDidUpdate);
+			return MDFastBindingValue_Select_Private::TrueItemName;
 		}
 		else
 		{
-			return GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::FalseItemName, bDidUpdate);
+			return MDFastBindingValue_Select_Private::FalseItemName;
 		}
 	}
 	else if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(InputValue.Key))
@@ -57,7 +91,7 @@ TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UO
 			const int64 Value = UnderlyingProp->GetSignedIntPropertyValue(InputValue.Value);
 			if (const FName* PinName = EnumValueToPinNameMap.Find(Value))
 			{
-				return GetBindingItemValue(SourceObject, *PinName, bDidUpdate);
+				return *PinName;
 			}
 		}
 	}
@@ -70,16 +104,15 @@ TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UO
 				const TTuple<const FProperty*, void*> ItemValue = BindingItem.GetValue(SourceObject, bDidUpdate);
 				if (FMDFastBindingHelpers::ArePropertyValuesEqual(ItemValue.Key, ItemValue.Value, InputValue.Key, InputValue.Value))
 				{
-					const FName& ResultValueName = FindOrCreateExtendableItemName(MDFastBindingValue_Select_Private::ToValueItemName, BindingItem.ExtendablePinListIndex);
-					return GetBindingItemValue(SourceObject, ResultValueName, bDidUpdate);
+					return FindOrCreateExtendableItemName(MDFastBindingValue_Select_Private::ToValueItemName, BindingItem.ExtendablePinListIndex);
 				}
 			}
 		}
 
-		return GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::FallbackResultInputName, bDidUpdate);
+		return MDFastBindingValue_Select_Private::FallbackResultInputName;
 	}
 
-	return {};
+	return NAME_None;
 }
 
 void UMDFastBindingValue_Select::SetupBindingItems()
@@ -0,0 +1,98 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "Components/MDFastBindingComponent.h"
+
+#include "Components/MDFastBindingTickSubsystem.h"
+#include "Engine/World.h"
+#include "MDFastBindingContainer.h"
+#include "MDFastBindingDirtyQueue.h"
+#include "MDFastBindingStats.h"
+
+UMDFastBindingComponent::UMDFastBindingComponent()
+{
+	// Bindings are updated by UMDFastBindingTickSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMDFastBindingComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (Bindings == nullptr)
+	{
+		// Component instances don't get changes to "Instance" UObject properties, so we copy them from the CDO directly
+		if (const UMDFastBindingComponent* CDO = GetClass()->GetDefaultObject<UMDFastBindingComponent>())
+		{
+			if (CDO->Bindings != nullptr)
+			{
+				LLM_SCOPE_BYTAG(MDFastBinding);
+				Bindings = DuplicateObject<UMDFastBindingContainer>(CDO->Bindings, this);
+				Bindings->SourceContainer = CDO->Bindings;
+			}
+		}
+	}
+
+	if (Bindings == nullptr || !Bindings->HasBindings())
+	{
+		return;
+	}
+
+	Bindings->InitializeBindings(this);
+
+	if (UMDFastBindingTickSubsystem* TickSubsystem = UWorld::GetSubsystem<UMDFastBindingTickSubsystem>(GetWorld()))
+	{
+		TickSubsystem->RegisterComponent(this);
+	}
+}
+
+void UMDFastBindingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMDFastBindingTickSubsystem* TickSubsystem = UWorld::GetSubsystem<UMDFastBindingTickSubsystem>(GetWorld()))
+	{
+		TickSubsystem->UnregisterComponent(this);
+	}
+
+	if (Bindings != nullptr)
+	{
+		Bindings->TerminateBindings(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+UClass* UMDFastBindingComponent::GetBindingOwnerClass() const
+{
+	return GetClass();
+}
+
+void UMDFastBindingComponent::UpdateBindings()
+{
+	if (Bindings == nullptr || !HasBegunPlay())
+	{
+		return;
+	}
+
+	// Catch anything that was marked dirty from another thread since the start of the frame
+	if (!FMDFastBindingDirtyQueue::IsEmpty())
+	{
+		FMDFastBindingDirtyQueue::Drain();
+	}
+
+	Bindings->UpdateBindings(this);
+}
+
+bool UMDFastBindingComponent::DoesNeedTick() const
+{
+	return Bindings != nullptr && Bindings->DoesNeedTick();
+}
+
+void UMDFastBindingComponent::UpdateNeedsTick()
+{
+	if (DoesNeedTick())
+	{
+		if (UMDFastBindingTickSubsystem* TickSubsystem = UWorld::GetSubsystem<UMDFastBindingTickSubsystem>(GetWorld()))
+		{
+			TickSubsystem->OnComponentNeedsTick(this);
+		}
+	}
+}
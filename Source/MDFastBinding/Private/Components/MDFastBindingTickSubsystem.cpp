@@ -0,0 +1,193 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "Components/MDFastBindingTickSubsystem.h"
+
+#include "Components/MDFastBindingComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "MDFastBindingContainer.h"
+#include "MDFastBindingDirtyQueue.h"
+
+void FMDFastBindingTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	UpdateBindings();
+}
+
+FString FMDFastBindingTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("MDFastBindingTickFunction[%s]"), *UEnum::GetValueAsString(TickGroup.GetValue()));
+}
+
+FName FMDFastBindingTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return TEXT("MDFastBindingTickFunction");
+}
+
+void FMDFastBindingTickFunction::UpdateBindings()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	if (!FMDFastBindingDirtyQueue::IsEmpty())
+	{
+		FMDFastBindingDirtyQueue::Drain();
+	}
+
+	bool bAnyNeedTick = false;
+
+	TArray<UMDFastBindingContainer*> Containers;
+	TArray<UObject*> SourceObjects;
+	for (auto It = ComponentsByClass.CreateIterator(); It; ++It)
+	{
+		TArray<TWeakObjectPtr<UMDFastBindingComponent>>& Components = It.Value();
+
+		Containers.Reset();
+		SourceObjects.Reset();
+		for (int32 i = Components.Num() - 1; i >= 0; --i)
+		{
+			UMDFastBindingComponent* Component = Components[i].Get();
+			if (Component == nullptr)
+			{
+				Components.RemoveAtSwap(i);
+				--NumComponents;
+				continue;
+			}
+
+			if (Component->DoesNeedTick())
+			{
+				Containers.Add(Component->GetBindingContainer());
+				SourceObjects.Add(Component);
+			}
+		}
+
+		if (Components.IsEmpty())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (Containers.Num() == 1)
+		{
+			Containers[0]->UpdateBindings(SourceObjects[0]);
+		}
+		else if (Containers.Num() > 1)
+		{
+			UMDFastBindingContainer::UpdateBindingsBatched(Containers, SourceObjects);
+		}
+
+		for (const UMDFastBindingContainer* Container : Containers)
+		{
+			bAnyNeedTick |= Container->DoesNeedTick();
+		}
+	}
+
+	// Sleep until a component needs to tick again
+	if (!bAnyNeedTick)
+	{
+		SetTickFunctionEnable(false);
+	}
+}
+
+void UMDFastBindingTickSubsystem::Deinitialize()
+{
+	for (TPair<TEnumAsByte<ETickingGroup>, TUniquePtr<FMDFastBindingTickFunction>>& Pair : TickFunctions)
+	{
+		Pair.Value->UnRegisterTickFunction();
+	}
+
+	TickFunctions.Empty();
+
+	Super::Deinitialize();
+}
+
+void UMDFastBindingTickSubsystem::RegisterComponent(UMDFastBindingComponent* Component)
+{
+	if (Component == nullptr)
+	{
+		return;
+	}
+
+	if (FMDFastBindingTickFunction* TickFunction = FindOrAddTickFunction(Component->GetBindingTickGroup()))
+	{
+		TArray<TWeakObjectPtr<UMDFastBindingComponent>>& Components = TickFunction->ComponentsByClass.FindOrAdd(Component->GetClass());
+		if (!Components.Contains(Component))
+		{
+			Components.Add(Component);
+			++TickFunction->NumComponents;
+		}
+
+		if (Component->DoesNeedTick())
+		{
+			TickFunction->SetTickFunctionEnable(true);
+		}
+	}
+}
+
+void UMDFastBindingTickSubsystem::UnregisterComponent(UMDFastBindingComponent* Component)
+{
+	if (Component == nullptr)
+	{
+		return;
+	}
+
+	const TUniquePtr<FMDFastBindingTickFunction>* TickFunction = TickFunctions.Find(Component->GetBindingTickGroup());
+	if (TickFunction == nullptr)
+	{
+		return;
+	}
+
+	if (TArray<TWeakObjectPtr<UMDFastBindingComponent>>* Components = (*TickFunction)->ComponentsByClass.Find(Component->GetClass()))
+	{
+		if (Components->RemoveSwap(Component) > 0)
+		{
+			--(*TickFunction)->NumComponents;
+		}
+
+		if (Components->IsEmpty())
+		{
+			(*TickFunction)->ComponentsByClass.Remove(Component->GetClass());
+		}
+	}
+
+	if ((*TickFunction)->NumComponents <= 0)
+	{
+		(*TickFunction)->SetTickFunctionEnable(false);
+	}
+}
+
+void UMDFastBindingTickSubsystem::OnComponentNeedsTick(UMDFastBindingComponent* Component)
+{
+	if (Component != nullptr)
+	{
+		if (const TUniquePtr<FMDFastBindingTickFunction>* TickFunction = TickFunctions.Find(Component->GetBindingTickGroup()))
+		{
+			(*TickFunction)->SetTickFunctionEnable(true);
+		}
+	}
+}
+
+bool UMDFastBindingTickSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FMDFastBindingTickFunction* UMDFastBindingTickSubsystem::FindOrAddTickFunction(ETickingGroup TickGroup)
+{
+	if (const TUniquePtr<FMDFastBindingTickFunction>* ExistingTickFunction = TickFunctions.Find(TickGroup))
+	{
+		return ExistingTickFunction->Get();
+	}
+
+	UWorld* World = GetWorld();
+	if (World == nullptr || World->PersistentLevel == nullptr)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FMDFastBindingTickFunction>& TickFunction = TickFunctions.Add(TickGroup, MakeUnique<FMDFastBindingTickFunction>());
+	TickFunction->TickGroup = TickGroup;
+	TickFunction->bCanEverTick = true;
+	TickFunction->bStartWithTickEnabled = false;
+	TickFunction->RegisterTickFunction(World->PersistentLevel);
+
+	return TickFunction.Get();
+}
@@ -2,11 +2,18 @@
 
 #include "MDFastBinding.h"
 
+#include "MDFastBindingAsyncLoader.h"
+#include "MDFastBindingDirtyQueue.h"
+#include "MDFastBindingFieldPath.h"
+#include "MDFastBindingHelpers.h"
+#include "MDFastBindingRecorder.h"
+#include "Misc/CoreDelegates.h"
 #include "Modules/ModuleManager.h"
 #include "PropertySetters/MDFastBindingPropertySetter_Colors.h"
 #include "PropertySetters/MDFastBindingPropertySetter_Containers.h"
 #include "PropertySetters/MDFastBindingPropertySetter_Numeric.h"
 #include "PropertySetters/MDFastBindingPropertySetter_Objects.h"
+#include "UObject/UObjectGlobals.h"
 #include "UObject/UnrealType.h"
 
 #define LOCTEXT_NAMESPACE "FMDFastBindingModule"
@@ -17,10 +24,37 @@ void FMDFastBindingModule::StartupModule()
 	AddPropertySetter(MakeShared<FMDFastBindingPropertySetter_Containers>());
 	AddPropertySetter(MakeShared<FMDFastBindingPropertySetter_Numeric>());
 	AddPropertySetter(MakeShared<FMDFastBindingPropertySetter_Colors>());
+
+	// Apply dirty marks queued from other threads before any bindings update this frame
+	BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&FMDFastBindingDirtyQueue::Drain);
+
+	// Field paths hold onto resolved fields, which are replaced when code is reloaded or blueprints are reinstanced
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		FMDFastBindingFieldPath::InvalidateAllPaths();
+	});
+#if WITH_EDITOR
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		FMDFastBindingFieldPath::InvalidateAllPaths();
+	});
+#endif
 }
 
 void FMDFastBindingModule::ShutdownModule()
 {
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+#endif
+
+	FMDFastBindingAsyncLoader::CancelAllLoads();
+
+#if MDFASTBINDING_RECORDING_ENABLED
+	// Flushes and closes the recording file if the app exits while recording
+	FMDFastBindingRecorder::StopRecording();
+#endif
 }
 
 void FMDFastBindingModule::AddPropertySetter(TSharedRef<IMDFastBindingPropertySetter> InPropertySetter)
@@ -49,11 +83,11 @@ bool FMDFastBindingModule::CanSetProperty(const FProperty* DestinationProp, cons
 	return SourceProp != nullptr && DestinationProp != nullptr && SourceProp->SameType(DestinationProp);
 }
 
-void FMDFastBindingModule::SetPropertyDirectly(const FProperty* DestinationProp, void* DestinationValuePtr, const FProperty* SourceProp, const void* SourceValuePtr)
+const IMDFastBindingPropertySetter* FMDFastBindingModule::FindPropertySetter(const FProperty* DestinationProp, const FProperty* SourceProp)
 {
-	if (SourceProp == nullptr || SourceValuePtr == nullptr || DestinationProp == nullptr || DestinationValuePtr == nullptr)
+	if (SourceProp == nullptr || DestinationProp == nullptr)
 	{
-		return;
+		return nullptr;
 	}
 
 	FMDFastBindingModule& Module = FModuleManager::GetModuleChecked<FMDFastBindingModule>(TEXT("MDFastBinding"));
@@ -61,15 +95,38 @@ void FMDFastBindingModule::SetPropertyDirectly(const FProperty* DestinationProp,
 	{
 		if (Setter->CanSetProperty(*DestinationProp, *SourceProp))
 		{
-			Setter->SetPropertyDirectly(*DestinationProp, DestinationValuePtr, *SourceProp, SourceValuePtr);
-			return;
+			return &Setter.Get();
 		}
 	}
 
+	return nullptr;
+}
+
+void FMDFastBindingModule::SetPropertyDirectly(const FProperty* DestinationProp, void* DestinationValuePtr, const FProperty* SourceProp, const void* SourceValuePtr)
+{
+	if (SourceProp == nullptr || SourceValuePtr == nullptr || DestinationProp == nullptr || DestinationValuePtr == nullptr)
+	{
+		return;
+	}
+
+	if (const IMDFastBindingPropertySetter* Setter = FindPropertySetter(DestinationProp, SourceProp))
+	{
+		Setter->SetPropertyDirectly(*DestinationProp, DestinationValuePtr, *SourceProp, SourceValuePtr);
+		return;
+	}
+
 	// Fallback to setting same type
 	if (SourceProp->SameType(DestinationProp))
 	{
-		DestinationProp->CopyCompleteValue(DestinationValuePtr, SourceValuePtr);
+		const FStructProperty* StructProp = CastField<const FStructProperty>(DestinationProp);
+		if (StructProp != nullptr && DestinationProp->ArrayDim == 1)
+		{
+			FMDFastBindingHelpers::CopyStructValueDelta(StructProp->Struct, DestinationValuePtr, SourceValuePtr);
+		}
+		else
+		{
+			DestinationProp->CopyCompleteValue(DestinationValuePtr, SourceValuePtr);
+		}
 	}
 }
 
@@ -93,7 +150,16 @@ void FMDFastBindingModule::SetPropertyInContainer(const FProperty* DestinationPr
 	// Fallback to setting same type
 	if (SourceProp->SameType(DestinationProp))
 	{
-		DestinationProp->SetValue_InContainer(DestinationContainerPtr, SourceValuePtr);
+		// Without a setter, structs can be written in place so only the members that changed are copied
+		const FStructProperty* StructProp = CastField<const FStructProperty>(DestinationProp);
+		if (StructProp != nullptr && !DestinationProp->HasSetter() && DestinationProp->ArrayDim == 1)
+		{
+			FMDFastBindingHelpers::CopyStructValueDelta(StructProp->Struct, DestinationProp->ContainerPtrToValuePtr<void>(DestinationContainerPtr), SourceValuePtr);
+		}
+		else
+		{
+			DestinationProp->SetValue_InContainer(DestinationContainerPtr, SourceValuePtr);
+		}
 	}
 }
 
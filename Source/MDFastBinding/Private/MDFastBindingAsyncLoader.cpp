@@ -0,0 +1,173 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingAsyncLoader.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "MDFastBindingInstance.h"
+#include "MDFastBindingLog.h"
+#include "MDFastBindingObject.h"
+
+namespace MDFastBindingAsyncLoader_Private
+{
+	// How often completed loads are checked for requesters that were destroyed before storing the loaded object
+	constexpr float CompletedLoadPruneInterval = 1.f;
+	// How long a path that failed to load is treated as null before it's requested again (eg. after content is mounted)
+	constexpr double FailedPathRetryDelay = 30.0;
+
+	struct FPendingLoad
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<TWeakObjectPtr<UMDFastBindingObject>> Requesters;
+	};
+
+	TMap<FSoftObjectPath, FPendingLoad> PendingLoads;
+	// Loaded objects stay referenced by their handle until every requester has stored them or has been destroyed
+	TMap<FSoftObjectPath, FPendingLoad> CompletedLoads;
+	FTSTicker::FDelegateHandle PruneCompletedLoadsHandle;
+	// Path to the time it failed to load
+	TMap<FSoftObjectPath, double> FailedPaths;
+
+	FStreamableManager& GetStreamableManager()
+	{
+		static FStreamableManager StreamableManager;
+		return StreamableManager;
+	}
+
+	bool PruneCompletedLoads(float)
+	{
+		for (auto It = CompletedLoads.CreateIterator(); It; ++It)
+		{
+			It->Value.Requesters.RemoveAllSwap([](const TWeakObjectPtr<UMDFastBindingObject>& Requester) { return !Requester.IsValid(); });
+			if (It->Value.Requesters.IsEmpty())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (CompletedLoads.IsEmpty())
+		{
+			PruneCompletedLoadsHandle.Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	void OnLoadCompleted(FSoftObjectPath Path)
+	{
+		FPendingLoad PendingLoad;
+		if (!PendingLoads.RemoveAndCopyValue(Path, PendingLoad))
+		{
+			return;
+		}
+
+		if (Path.ResolveObject() == nullptr)
+		{
+			UE_LOG(LogMDFastBinding, Warning, TEXT("Failed to async load [%s] for a binding, it will be treated as null"), *Path.ToString());
+			FailedPaths.Add(Path, FPlatformTime::Seconds());
+		}
+		else if (PendingLoad.Handle.IsValid())
+		{
+			CompletedLoads.Add(Path, PendingLoad);
+			if (!PruneCompletedLoadsHandle.IsValid())
+			{
+				PruneCompletedLoadsHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&PruneCompletedLoads), CompletedLoadPruneInterval);
+			}
+		}
+
+		for (const TWeakObjectPtr<UMDFastBindingObject>& WeakRequester : PendingLoad.Requesters)
+		{
+			if (UMDFastBindingObject* Requester = WeakRequester.Get())
+			{
+				Requester->MarkPathDirty();
+				if (UMDFastBindingInstance* Binding = Requester->GetOuterBinding())
+				{
+					Binding->MarkBindingDirty();
+				}
+			}
+		}
+	}
+}
+
+UMDFastBindingObject* FMDFastBindingAsyncLoader::CurrentRequester = nullptr;
+
+bool FMDFastBindingAsyncLoader::RequestLoad(const FSoftObjectPath& Path)
+{
+	using namespace MDFastBindingAsyncLoader_Private;
+
+	if (CurrentRequester == nullptr || Path.IsNull() || !IsInGameThread())
+	{
+		return false;
+	}
+
+	if (const double* FailedTime = FailedPaths.Find(Path))
+	{
+		if (FPlatformTime::Seconds() - *FailedTime < FailedPathRetryDelay)
+		{
+			return false;
+		}
+
+		FailedPaths.Remove(Path);
+	}
+
+	if (FPendingLoad* PendingLoad = PendingLoads.Find(Path))
+	{
+		PendingLoad->Requesters.AddUnique(CurrentRequester);
+		return true;
+	}
+
+	FPendingLoad& PendingLoad = PendingLoads.Add(Path);
+	PendingLoad.Requesters.Add(CurrentRequester);
+
+	// The handle can complete immediately if the object is already loading, so add it to the map first
+	TSharedPtr<FStreamableHandle> Handle = GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate::CreateStatic(&OnLoadCompleted, Path));
+	if (FPendingLoad* StillPendingLoad = PendingLoads.Find(Path))
+	{
+		StillPendingLoad->Handle = Handle;
+	}
+
+	return true;
+}
+
+void FMDFastBindingAsyncLoader::NotifyLoadConsumed(const FSoftObjectPath& Path)
+{
+	using namespace MDFastBindingAsyncLoader_Private;
+
+	if (CompletedLoads.IsEmpty() || CurrentRequester == nullptr || !IsInGameThread())
+	{
+		return;
+	}
+
+	if (FPendingLoad* CompletedLoad = CompletedLoads.Find(Path))
+	{
+		CompletedLoad->Requesters.RemoveSwap(CurrentRequester);
+		if (CompletedLoad->Requesters.IsEmpty())
+		{
+			CompletedLoads.Remove(Path);
+		}
+	}
+}
+
+void FMDFastBindingAsyncLoader::CancelAllLoads()
+{
+	using namespace MDFastBindingAsyncLoader_Private;
+
+	TMap<FSoftObjectPath, FPendingLoad> Loads = MoveTemp(PendingLoads);
+	for (TPair<FSoftObjectPath, FPendingLoad>& Pair : Loads)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->CancelHandle();
+		}
+	}
+
+	CompletedLoads.Reset();
+	if (PruneCompletedLoadsHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PruneCompletedLoadsHandle);
+		PruneCompletedLoadsHandle.Reset();
+	}
+
+	FailedPaths.Reset();
+}
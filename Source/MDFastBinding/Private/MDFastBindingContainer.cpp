@@ -4,12 +4,29 @@
 #include "MDFastBindingInstance.h"
 #include "MDFastBindingLog.h"
 #include "MDFastBindingOwnerInterface.h"
+#include "MDFastBindingStats.h"
+#include "MDFastBindingTrace.h"
+#include "MDFastBindingWidgetUpdateBatch.h"
 #include "BindingDestinations/MDFastBindingDestinationBase.h"
 #include "Blueprint/UserWidget.h"
+#include "Components/MDFastBindingComponent.h"
 #include "WidgetExtension/MDFastBindingWidgetExtension.h"
 
+#if WITH_EDITOR
+namespace MDFastBindingContainer_Private
+{
+	FString GetDestinationKey(const UMDFastBindingInstance& Binding)
+	{
+		const UMDFastBindingDestinationBase* Destination = Binding.GetBindingDestination();
+		return Destination != nullptr ? Destination->GetDestinationKey() : FString();
+	}
+}
+#endif
+
 void UMDFastBindingContainer::InitializeBindings(UObject* SourceObject)
 {
+	LLM_SCOPE_BYTAG(MDFastBinding);
+
 	if (const UUserWidget* OuterWidget = Cast<UUserWidget>(GetOuter()))
 	{
 		UE_CLOG(!OuterWidget->IsDesignTime(), LogMDFastBinding, Warning, TEXT("[%s] uses a deprecated property-based MDFastBindingContainer, resave it to automatically upgrade it to a widget extension"), *GetNameSafe(OuterWidget->GetClass()));
@@ -17,6 +34,8 @@ void UMDFastBindingContainer::InitializeBindings(UObject* SourceObject)
 
 	TickingBindings.Insert(false, 0, Bindings.Num());
 
+	FMDFastBindingWidgetUpdateBatchScope WidgetUpdateBatch;
+
 	for (int32 i = 0; i < Bindings.Num(); ++i)
 	{
 		if (UMDFastBindingInstance* Binding = Bindings[i])
@@ -30,7 +49,9 @@ void UMDFastBindingContainer::InitializeBindings(UObject* SourceObject)
 void UMDFastBindingContainer::UpdateBindings(UObject* SourceObject)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
-	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetNameSafe(SourceObject));
+	MDFASTBINDING_TRACE_SCOPE(GetTraceSpecId());
+
+	FMDFastBindingWidgetUpdateBatchScope WidgetUpdateBatch;
 
 	for (TConstSetBitIterator<> It(TickingBindings); It; ++It)
 	{
@@ -38,6 +59,33 @@ void UMDFastBindingContainer::UpdateBindings(UObject* SourceObject)
 	}
 }
 
+void UMDFastBindingContainer::UpdateBindingsBatched(TArrayView<UMDFastBindingContainer* const> Containers, TArrayView<UObject* const> SourceObjects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	check(Containers.Num() == SourceObjects.Num());
+
+	FMDFastBindingWidgetUpdateBatchScope WidgetUpdateBatch;
+
+	int32 NumBindings = 0;
+	for (const UMDFastBindingContainer* Container : Containers)
+	{
+		NumBindings = FMath::Max(NumBindings, Container->Bindings.Num());
+	}
+
+	for (int32 BindingIndex = 0; BindingIndex < NumBindings; ++BindingIndex)
+	{
+		for (int32 i = 0; i < Containers.Num(); ++i)
+		{
+			UMDFastBindingContainer* Container = Containers[i];
+			if (Container->TickingBindings.IsValidIndex(BindingIndex) && Container->TickingBindings[BindingIndex])
+			{
+				Container->TickingBindings[BindingIndex] = Container->Bindings[BindingIndex]->UpdateBinding(SourceObjects[i]);
+			}
+		}
+	}
+}
+
 void UMDFastBindingContainer::TerminateBindings(UObject* SourceObject)
 {
 	for (UMDFastBindingInstance* Binding : Bindings)
@@ -102,6 +150,7 @@ UMDFastBindingInstance* UMDFastBindingContainer::DuplicateBinding(UMDFastBinding
 					Object->BindingObjectIdentifier = FGuid::NewGuid();
 				}
 			}
+			NewBinding->MarkStructureChanged();
 
 			Bindings.Insert(NewBinding, CurrentIdx + 1);
 			return NewBinding;
@@ -153,6 +202,108 @@ EDataValidationResult UMDFastBindingContainer::IsDataValid(TArray<FText>& Valida
 
 	return Result;
 }
+
+EDataValidationResult UMDFastBindingContainer::IsDataValidCached(TArray<FText>& ValidationErrors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	EDataValidationResult Result = EDataValidationResult::Valid;
+	TMap<const UStruct*, uint64> LayoutHashes;
+
+	for (UMDFastBindingInstance* Binding : Bindings)
+	{
+		if (Binding != nullptr)
+		{
+			if (Binding->IsDataValidCached(ValidationErrors, LayoutHashes) == EDataValidationResult::Invalid)
+			{
+				Result = EDataValidationResult::Invalid;
+			}
+		}
+	}
+
+	return Result;
+}
+
+void UMDFastBindingContainer::AppendFlattenedBindings(const UMDFastBindingContainer* SourceContainer, TSet<FString>& InOutDestinationKeys)
+{
+	if (SourceContainer == nullptr)
+	{
+		return;
+	}
+
+	TArray<FString> SourceDestinationKeys;
+	for (const UMDFastBindingInstance* Binding : SourceContainer->Bindings)
+	{
+		if (Binding == nullptr)
+		{
+			continue;
+		}
+
+		const FString DestinationKey = MDFastBindingContainer_Private::GetDestinationKey(*Binding);
+		if (!DestinationKey.IsEmpty())
+		{
+			if (InOutDestinationKeys.Contains(DestinationKey))
+			{
+				UE_LOG(LogMDFastBinding, Verbose, TEXT("[%s] Binding [%s] is overridden by a child class binding that sets [%s]"),
+					*GetNameSafe(GetBindingOwnerClass()), *Binding->GetBindingDisplayName().ToString(), *DestinationKey);
+				continue;
+			}
+
+			SourceDestinationKeys.Add(DestinationKey);
+		}
+
+		if (UMDFastBindingInstance* NewBinding = DuplicateObject<UMDFastBindingInstance>(Binding, this, NAME_None))
+		{
+			Bindings.Add(NewBinding);
+		}
+	}
+
+	InOutDestinationKeys.Append(SourceDestinationKeys);
+}
+
+void UMDFastBindingContainer::RemoveOverriddenBindings(TSet<FString>& InOutDestinationKeys)
+{
+	TArray<FString> DestinationKeys;
+	for (int32 i = Bindings.Num() - 1; i >= 0; --i)
+	{
+		const UMDFastBindingInstance* Binding = Bindings[i];
+		if (Binding == nullptr)
+		{
+			continue;
+		}
+
+		const FString DestinationKey = MDFastBindingContainer_Private::GetDestinationKey(*Binding);
+		if (DestinationKey.IsEmpty())
+		{
+			continue;
+		}
+
+		if (InOutDestinationKeys.Contains(DestinationKey))
+		{
+			UE_LOG(LogMDFastBinding, Verbose, TEXT("[%s] Binding [%s] is overridden by a child class binding that sets [%s]"),
+				*GetNameSafe(GetBindingOwnerClass()), *Binding->GetBindingDisplayName().ToString(), *DestinationKey);
+			Bindings.RemoveAt(i);
+		}
+		else
+		{
+			DestinationKeys.Add(DestinationKey);
+		}
+	}
+
+	InOutDestinationKeys.Append(DestinationKeys);
+}
+#endif
+
+#if CPUPROFILERTRACE_ENABLED
+uint32 UMDFastBindingContainer::GetTraceSpecId() const
+{
+	if (TraceSpecId == 0)
+	{
+		TraceSpecId = FMDFastBindingTrace::GetEventType(FString::Printf(TEXT("%s Bindings"), *GetNameSafe(GetBindingOwnerClass())));
+	}
+
+	return TraceSpecId;
+}
 #endif
 
 void UMDFastBindingContainer::UpdateNeedsTick()
@@ -161,4 +312,8 @@ void UMDFastBindingContainer::UpdateNeedsTick()
 	{
 		Extension->UpdateNeedsTick();
 	}
+	else if (UMDFastBindingComponent* Component = Cast<UMDFastBindingComponent>(GetOuter()))
+	{
+		Component->UpdateNeedsTick();
+	}
 }
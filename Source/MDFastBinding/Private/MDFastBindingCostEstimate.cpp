@@ -0,0 +1,85 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingCostEstimate.h"
+
+#include "UObject/Class.h"
+#include "UObject/Field.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingCostEstimate"
+
+namespace MDFastBindingCostEstimate_Private
+{
+	// Rough microsecond costs per operation, in the ballpark of a development build on desktop hardware
+	constexpr double NodeCost = 0.05;
+	constexpr double PathHopCost = 0.02;
+	constexpr double FunctionCallCost = 0.4;
+	constexpr double ContainerCopyCost = 0.5;
+	constexpr double TextFormatCost = 2.0;
+	constexpr double SetterCallCost = 0.3;
+}
+
+void FMDFastBindingCostEstimate::AddPath(const TArray<FFieldVariant>& Path)
+{
+	NumPathHops += Path.Num();
+	MaxPathDepth = FMath::Max(MaxPathDepth, Path.Num());
+
+	for (const FFieldVariant& Field : Path)
+	{
+		if (Field.IsA<UFunction>())
+		{
+			++NumFunctionCalls;
+		}
+	}
+}
+
+double FMDFastBindingCostEstimate::GetMicrosecondsPerUpdate() const
+{
+	using namespace MDFastBindingCostEstimate_Private;
+
+	return NumNodes * NodeCost
+		+ NumPathHops * PathHopCost
+		+ NumFunctionCalls * FunctionCallCost
+		+ NumContainerCopies * ContainerCopyCost
+		+ NumTextFormats * TextFormatCost
+		+ NumSetterCalls * SetterCallCost;
+}
+
+FText FMDFastBindingCostEstimate::GetSummaryText() const
+{
+	FNumberFormattingOptions Options;
+	Options.SetMinimumFractionalDigits(1);
+	Options.SetMaximumFractionalDigits(1);
+
+	if (bTicks)
+	{
+		return FText::Format(LOCTEXT("PerFrameSummary", "~{0} us/frame"), FText::AsNumber(GetMicrosecondsPerFrame(), &Options));
+	}
+
+	return FText::Format(LOCTEXT("PerUpdateSummary", "~{0} us/update"), FText::AsNumber(GetMicrosecondsPerUpdate(), &Options));
+}
+
+FText FMDFastBindingCostEstimate::GetBreakdownText() const
+{
+	FNumberFormattingOptions Options;
+	Options.SetMinimumFractionalDigits(2);
+	Options.SetMaximumFractionalDigits(2);
+
+	const FText UpdateFrequencyText = bTicks
+		? LOCTEXT("TicksText", "Updates every frame")
+		: LOCTEXT("DoesNotTickText", "Only updates when its inputs change");
+
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("Frequency"), UpdateFrequencyText);
+	Args.Add(TEXT("Microseconds"), FText::AsNumber(GetMicrosecondsPerUpdate(), &Options));
+	Args.Add(TEXT("Nodes"), NumNodes);
+	Args.Add(TEXT("PathHops"), NumPathHops);
+	Args.Add(TEXT("MaxPathDepth"), MaxPathDepth);
+	Args.Add(TEXT("FunctionCalls"), NumFunctionCalls);
+	Args.Add(TEXT("ContainerCopies"), NumContainerCopies);
+	Args.Add(TEXT("TextFormats"), NumTextFormats);
+	Args.Add(TEXT("SetterCalls"), NumSetterCalls);
+
+	return FText::Format(LOCTEXT("BreakdownFormat", "Estimated cost: ~{Microseconds} us per update\n{Frequency}\n\nNodes: {Nodes}\nProperty path hops: {PathHops} (deepest: {MaxPathDepth})\nFunction calls: {FunctionCalls}\nContainer/string copies: {ContainerCopies}\nText formats: {TextFormats}\nSetter calls: {SetterCalls}"), Args);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,35 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingDirtyQueue.h"
+
+#include "Containers/Queue.h"
+#include "MDFastBindingObject.h"
+
+namespace MDFastBindingDirtyQueue_Private
+{
+	TQueue<TWeakObjectPtr<UMDFastBindingObject>, EQueueMode::Mpsc> DirtyObjects;
+}
+
+void FMDFastBindingDirtyQueue::Enqueue(const TWeakObjectPtr<UMDFastBindingObject>& Object)
+{
+	MDFastBindingDirtyQueue_Private::DirtyObjects.Enqueue(Object);
+}
+
+void FMDFastBindingDirtyQueue::Drain()
+{
+	check(IsInGameThread());
+
+	TWeakObjectPtr<UMDFastBindingObject> WeakObject;
+	while (MDFastBindingDirtyQueue_Private::DirtyObjects.Dequeue(WeakObject))
+	{
+		if (UMDFastBindingObject* Object = WeakObject.Get())
+		{
+			Object->MarkDequeuedObjectDirty();
+		}
+	}
+}
+
+bool FMDFastBindingDirtyQueue::IsEmpty()
+{
+	return MDFastBindingDirtyQueue_Private::DirtyObjects.IsEmpty();
+}
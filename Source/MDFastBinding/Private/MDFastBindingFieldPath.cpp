@@ -8,6 +8,13 @@
 #include "FieldNotification/IFieldValueChanged.h"
 #endif
 #include "MDFastBindingHelpers.h"
+#include "MDFastBindingMemoryReport.h"
+#include "MDFastBindingStats.h"
+
+namespace MDFastBindingFieldPath_Private
+{
+	uint32 PathGeneration = 1;
+}
 
 FMDFastBindingFieldPath::~FMDFastBindingFieldPath()
 {
@@ -19,6 +26,7 @@ bool FMDFastBindingFieldPath::BuildPath()
 	FixupFieldPath();
 
 	CachedPath.Empty(FieldPathMembers.Num());
+	CachedPathGeneration = MDFastBindingFieldPath_Private::PathGeneration;
 
 	if (UStruct* OwnerStruct = GetPathOwnerStruct())
 	{
@@ -28,22 +36,22 @@ bool FMDFastBindingFieldPath::BuildPath()
 			if (FieldPathMember.bIsFunction)
 			{
 				UFunction* Func = FieldPathMember.ResolveMember<UFunction>(Cast<UClass>(OwnerStruct));
-				CachedPath.Add(Func);
 
 				TArray<TWeakFieldPtr<const FProperty>> Params;
 				FMDFastBindingHelpers::SplitFunctionParamsAndReturnProp(Func, Params, NextProp);
+				CachedPath.Add(Func).SetValueProperty(NextProp.Get());
 			}
 			else if (const FProperty* Prop = FieldPathMember.ResolveMember<FProperty>(Cast<UClass>(OwnerStruct)))
 			{
 				NextProp = Prop;
-				CachedPath.Add(Prop);
+				CachedPath.Add(Prop).SetValueProperty(Prop);
 			}
 			else if (OwnerStruct != nullptr)
 			{
 				// FMemberReference only supports members of UObjects, so we have to manually handle UStruct members
 				const FProperty* StructProp = OwnerStruct->FindPropertyByName(FieldPathMember.GetMemberName());
 				NextProp = StructProp;
-				CachedPath.Add(StructProp);
+				CachedPath.Add(StructProp).SetValueProperty(StructProp);
 			}
 
 			if (const FObjectPropertyBase* ObjectProp = CastField<const FObjectPropertyBase>(NextProp.Get()))
@@ -103,9 +111,11 @@ const TArray<FMDFastBindingWeakFieldVariant>& FMDFastBindingFieldPath::GetWeakFi
 		}
 	}
 	// Only cached once per frame, since the user could change the path
-	if (!bIsCacheValid || !LastFrameUpdatedPath.IsSet() || LastFrameUpdatedPath.GetValue() != GFrameCounter)
+	if (!bIsCacheValid || !LastFrameUpdatedPath.IsSet() || LastFrameUpdatedPath.GetValue() != GFrameCounter
+		|| CachedPathGeneration != MDFastBindingFieldPath_Private::PathGeneration)
 #else
-	if (CachedPath.Num() == 0)
+	// Classes don't change at runtime, so the cached fields are good until code is reloaded
+	if (CachedPath.Num() == 0 || CachedPathGeneration != MDFastBindingFieldPath_Private::PathGeneration)
 #endif
 	{
 		BuildPath();
@@ -144,7 +154,7 @@ TTuple<const FProperty*, void*> FMDFastBindingFieldPath::ResolvePathFromRootObje
 		for (int32 i = 0; i < Path.Num() && Owner != nullptr; ++i)
 		{
 			const FMDFastBindingWeakFieldVariant& FieldVariant = Path[i];
-			TWeakFieldPtr<const FProperty> OwnerProp = nullptr;
+			const FProperty* OwnerProp = FieldVariant.GetValueProperty();
 			LastOwner = Owner;
 
 			if (UFunction* Func = Cast<UFunction>(FieldVariant.ToUObject()))
@@ -164,6 +174,11 @@ TTuple<const FProperty*, void*> FMDFastBindingFieldPath::ResolvePathFromRootObje
 					{
 						return {};
 					}
+
+					TWeakFieldPtr<const FProperty> ReturnProp = nullptr;
+					TArray<TWeakFieldPtr<const FProperty>> Params;
+					FMDFastBindingHelpers::SplitFunctionParamsAndReturnProp(Func, Params, ReturnProp);
+					OwnerProp = ReturnProp.Get();
 				}
 
 				void* FuncMemory = InitAndGetFunctionMemory(Func);
@@ -173,15 +188,10 @@ TTuple<const FProperty*, void*> FMDFastBindingFieldPath::ResolvePathFromRootObje
 				}
 
 				OwnerUObject->ProcessEvent(Func, FuncMemory);
-
-				TArray<TWeakFieldPtr<const FProperty>> Params;
-				FMDFastBindingHelpers::SplitFunctionParamsAndReturnProp(Func, Params, OwnerProp);
 				Owner = FuncMemory;
 			}
 			else if (const FProperty* Prop = CastField<const FProperty>(FieldVariant.ToField()))
 			{
-				OwnerProp = Prop;
-
 				if (bIsOwnerAUObject)
 				{
 					if (UObject* OwnerObject = *static_cast<UObject**>(LastOwner))
@@ -254,7 +264,7 @@ TTuple<const FProperty*, void*> FMDFastBindingFieldPath::ResolvePathFromRootObje
 					OutContainer = LastOwner;
 				}
 
-				return TTuple<const FProperty*, void*>{ OwnerProp.Get(), Owner };
+				return TTuple<const FProperty*, void*>{ OwnerProp, Owner };
 			}
 
 			bIsOwnerAUObject = OwnerProp != nullptr && OwnerProp->IsA(FObjectPropertyBase::StaticClass());
@@ -291,24 +301,7 @@ const FProperty* FMDFastBindingFieldPath::GetLeafProperty()
 {
 	const TArray<FMDFastBindingWeakFieldVariant>& Path = GetWeakFieldPath();
 
-	if (Path.Num() > 0)
-	{
-		const FMDFastBindingWeakFieldVariant& FieldVariant = Path.Last();
-
-		if (const UFunction* Func = Cast<UFunction>(FieldVariant.ToUObject()))
-		{
-			TWeakFieldPtr<const FProperty> ReturnProp = nullptr;
-			TArray<TWeakFieldPtr<const FProperty>> Params;
-			FMDFastBindingHelpers::SplitFunctionParamsAndReturnProp(Func, Params, ReturnProp);
-			return ReturnProp.Get();
-		}
-		else if (const FProperty* Prop = CastField<const FProperty>(FieldVariant.ToField()))
-		{
-			return Prop;
-		}
-	}
-
-	return nullptr;
+	return Path.Num() > 0 ? Path.Last().GetValueProperty() : nullptr;
 }
 
 bool FMDFastBindingFieldPath::IsLeafFunction()
@@ -393,6 +386,11 @@ void FMDFastBindingFieldPath::OnVariableRenamed(UClass* VariableClass, const FNa
 }
 #endif
 
+void FMDFastBindingFieldPath::InvalidateAllPaths()
+{
+	++MDFastBindingFieldPath_Private::PathGeneration;
+}
+
 UStruct* FMDFastBindingFieldPath::GetPathOwnerStruct() const
 {
 	return OwnerStructGetter.IsBound() ? OwnerStructGetter.Execute() : nullptr;
@@ -407,6 +405,8 @@ void* FMDFastBindingFieldPath::InitAndGetFunctionMemory(const UFunction* Func)
 			return *MemoryPtr;
 		}
 
+		LLM_SCOPE_BYTAG(MDFastBinding);
+
 		void* Memory = nullptr;
 		TArray<const FProperty*> Params;
 		FMDFastBindingHelpers::GetFunctionParamProps(Func, Params);
@@ -460,6 +460,8 @@ void* FMDFastBindingFieldPath::InitAndGetPropertyMemory(const FProperty* Propert
 			return *MemoryPtr;
 		}
 
+		LLM_SCOPE_BYTAG(MDFastBinding);
+
 		void* Memory = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
 		Property->InitializeValue(Memory);
 		PropertyMemory.Add(MoveTemp(WeakProp), Memory);
@@ -488,6 +490,29 @@ void FMDFastBindingFieldPath::CleanupPropertyMemory()
 	PropertyMemory.Empty();
 }
 
+void FMDFastBindingFieldPath::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	for (const TPair<TWeakObjectPtr<const UFunction>, void*>& FuncPair : FunctionMemory)
+	{
+		if (const UFunction* Func = FuncPair.Key.Get())
+		{
+			InOutMemory.AddAllocation(Func->ParmsSize);
+
+			TArray<const FProperty*> Params;
+			FMDFastBindingHelpers::GetFunctionParamProps(Func, Params);
+			for (const FProperty* Param : Params)
+			{
+				InOutMemory.AddNestedAllocations(Param, Param->ContainerPtrToValuePtr<void>(FuncPair.Value));
+			}
+		}
+	}
+
+	for (const TPair<TWeakFieldPtr<FProperty>, void*>& PropertyPair : PropertyMemory)
+	{
+		InOutMemory.AddPropertyValue(PropertyPair.Key.Get(), PropertyPair.Value);
+	}
+}
+
 void FMDFastBindingFieldPath::FixupFieldPath()
 {
 	// Check if we need to convert to the Member Reference path
@@ -3,6 +3,8 @@
 #include "MDFastBindingFunctionWrapper.h"
 
 #include "MDFastBindingHelpers.h"
+#include "MDFastBindingMemoryReport.h"
+#include "MDFastBindingStats.h"
 
 
 FMDFastBindingFunctionWrapper::~FMDFastBindingFunctionWrapper()
@@ -179,10 +181,27 @@ UObject* FMDFastBindingFunctionWrapper::GetFunctionOwner(UObject* SourceObject)
 	return OwnerGetter.IsBound() ? OwnerGetter.Execute(SourceObject) : nullptr;
 }
 
+void FMDFastBindingFunctionWrapper::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	if (FunctionPtr != nullptr && FunctionMemory != nullptr)
+	{
+		InOutMemory.AddAllocation(FunctionPtr->ParmsSize);
+
+		TArray<const FProperty*> AllParams;
+		FMDFastBindingHelpers::GetFunctionParamProps(FunctionPtr, AllParams);
+		for (const FProperty* Param : AllParams)
+		{
+			InOutMemory.AddNestedAllocations(Param, Param->ContainerPtrToValuePtr<void>(FunctionMemory));
+		}
+	}
+}
+
 void FMDFastBindingFunctionWrapper::InitFunctionMemory()
 {
 	if (FunctionPtr != nullptr && FunctionMemory == nullptr)
 	{
+		LLM_SCOPE_BYTAG(MDFastBinding);
+
 		TArray<const FProperty*> AllParams;
 		FMDFastBindingHelpers::GetFunctionParamProps(FunctionPtr, AllParams);
 
@@ -4,6 +4,7 @@
 #include "UObject/UnrealType.h"
 
 #include "MDFastBinding.h"
+#include "Algo/Sort.h"
 #include "Blueprint/WidgetBlueprintGeneratedClass.h"
 #include "WidgetExtension/MDFastBindingWidgetClassExtension.h"
 
@@ -116,6 +117,207 @@ bool FMDFastBindingHelpers::ArePropertyValuesEqual(const FProperty* PropA, const
 	return bResult;
 }
 
+bool FMDFastBindingHelpers::CanCopyStructMemberwise(const UScriptStruct* Struct)
+{
+	if (Struct == nullptr)
+	{
+		return false;
+	}
+
+	// Native copy or compare operators may do more than their members (eg. copy-on-write handles, caches) so they always have to be used
+	if ((Struct->StructFlags & (STRUCT_CopyNative | STRUCT_IdenticalNative)) != 0)
+	{
+		return false;
+	}
+
+	struct FMemberwiseCopyInfo
+	{
+		const FProperty* PropertyLink = nullptr;
+		bool bCanCopyMemberwise = false;
+	};
+
+	// The property link changes whenever the struct is relinked (eg. user defined struct recompiles), which invalidates the cached result
+	static TMap<TWeakObjectPtr<const UScriptStruct>, FMemberwiseCopyInfo> MemberwiseCopyCache;
+	FMemberwiseCopyInfo* InfoPtr = MemberwiseCopyCache.Find(Struct);
+	if (InfoPtr == nullptr)
+	{
+		// New structs are rare, so drop the entries of any structs that were destroyed (eg. reinstanced user defined structs) when one is added
+		for (auto It = MemberwiseCopyCache.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		InfoPtr = &MemberwiseCopyCache.Add(Struct);
+	}
+
+	FMemberwiseCopyInfo& Info = *InfoPtr;
+	if (Info.PropertyLink == Struct->PropertyLink && Info.PropertyLink != nullptr)
+	{
+		return Info.bCanCopyMemberwise;
+	}
+
+	Info.PropertyLink = Struct->PropertyLink;
+	Info.bCanCopyMemberwise = false;
+
+	TArray<const FProperty*> Members;
+	for (TFieldIterator<const FProperty> It(Struct); It; ++It)
+	{
+		Members.Add(*It);
+	}
+
+	if (Members.IsEmpty())
+	{
+		return false;
+	}
+
+	Algo::SortBy(Members, &FProperty::GetOffset_ForInternal);
+
+	// Reflected members have to cover every byte of the struct. A gap could be padding, but it could also be a small native member
+	// that reflection doesn't know about, so structs with padding are conservatively copied whole.
+	// Members can overlap, bitfield bools share their byte.
+	int32 CoveredBytes = 0;
+	for (const FProperty* Member : Members)
+	{
+		const int32 Offset = Member->GetOffset_ForInternal();
+		if (Offset > CoveredBytes)
+		{
+			return false;
+		}
+
+		CoveredBytes = FMath::Max(CoveredBytes, Offset + Member->GetSize());
+	}
+
+	Info.bCanCopyMemberwise = CoveredBytes == Struct->GetStructureSize();
+	return Info.bCanCopyMemberwise;
+}
+
+bool FMDFastBindingHelpers::CopyStructValueDelta(const UScriptStruct* Struct, void* DestinationValuePtr, const void* SourceValuePtr)
+{
+	if (Struct == nullptr || DestinationValuePtr == nullptr || SourceValuePtr == nullptr || DestinationValuePtr == SourceValuePtr)
+	{
+		return false;
+	}
+
+	// Plain old data is compared and copied as one block of memory, which is cheaper than going member by member
+	if ((Struct->StructFlags & STRUCT_IsPlainOldData) != 0)
+	{
+		const int32 StructSize = Struct->GetStructureSize();
+		if (FMemory::Memcmp(DestinationValuePtr, SourceValuePtr, StructSize) == 0)
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(DestinationValuePtr, SourceValuePtr, StructSize);
+		return true;
+	}
+
+	if (!CanCopyStructMemberwise(Struct))
+	{
+		if (Struct->CompareScriptStruct(DestinationValuePtr, SourceValuePtr, PPF_None))
+		{
+			return false;
+		}
+
+		Struct->CopyScriptStruct(DestinationValuePtr, SourceValuePtr);
+		return true;
+	}
+
+	bool bDidCopy = false;
+	for (TFieldIterator<const FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Member = *It;
+		const FStructProperty* StructMember = CastField<const FStructProperty>(Member);
+		for (int32 i = 0; i < Member->ArrayDim; ++i)
+		{
+			void* DestMemberPtr = Member->ContainerPtrToValuePtr<void>(DestinationValuePtr, i);
+			const void* SourceMemberPtr = Member->ContainerPtrToValuePtr<void>(SourceValuePtr, i);
+			if (StructMember != nullptr)
+			{
+				bDidCopy |= CopyStructValueDelta(StructMember->Struct, DestMemberPtr, SourceMemberPtr);
+			}
+			else if (!Member->Identical(DestMemberPtr, SourceMemberPtr))
+			{
+				Member->CopySingleValue(DestMemberPtr, SourceMemberPtr);
+				bDidCopy = true;
+			}
+		}
+	}
+
+	return bDidCopy;
+}
+
+void FMDFastBindingHelpers::AddReferencedObjectsInValue(FReferenceCollector& Collector, const FProperty* Prop, void* ValuePtr, const UObject* ReferencingObject)
+{
+	if (Prop == nullptr || ValuePtr == nullptr)
+	{
+		return;
+	}
+
+	const int32 ElementSize = Prop->GetSize() / FMath::Max(1, Prop->ArrayDim);
+	for (int32 i = 0; i < Prop->ArrayDim; ++i)
+	{
+		void* ElementPtr = static_cast<uint8*>(ValuePtr) + i * ElementSize;
+
+		// Weak, lazy and soft object properties are also FObjectPropertyBase but don't hold strong references
+		if (CastField<const FObjectProperty>(Prop) != nullptr)
+		{
+			Collector.AddReferencedObject(*static_cast<TObjectPtr<UObject>*>(ElementPtr), ReferencingObject);
+		}
+		else if (CastField<const FInterfaceProperty>(Prop) != nullptr)
+		{
+			Collector.AddReferencedObject(static_cast<FScriptInterface*>(ElementPtr)->GetObjectRef(), ReferencingObject);
+		}
+		else if (const FStructProperty* StructProp = CastField<const FStructProperty>(Prop))
+		{
+			// Members can be interfaces or containers of objects too, so recurse through each of them
+			for (TFieldIterator<const FProperty> It(StructProp->Struct); It; ++It)
+			{
+				AddReferencedObjectsInValue(Collector, *It, It->ContainerPtrToValuePtr<void>(ElementPtr), ReferencingObject);
+			}
+
+			// Native structs can hold references that reflection doesn't know about
+			if (StructProp->Struct->StructFlags & STRUCT_AddStructReferencedObjects)
+			{
+				StructProp->Struct->GetCppStructOps()->AddStructReferencedObjects()(ElementPtr, Collector);
+			}
+		}
+		else if (const FArrayProperty* ArrayProp = CastField<const FArrayProperty>(Prop))
+		{
+			FScriptArrayHelper Helper(ArrayProp, ElementPtr);
+			for (int32 j = 0; j < Helper.Num(); ++j)
+			{
+				AddReferencedObjectsInValue(Collector, ArrayProp->Inner, Helper.GetRawPtr(j), ReferencingObject);
+			}
+		}
+		else if (const FSetProperty* SetProp = CastField<const FSetProperty>(Prop))
+		{
+			FScriptSetHelper Helper(SetProp, ElementPtr);
+			for (int32 j = 0; j < Helper.GetMaxIndex(); ++j)
+			{
+				if (Helper.IsValidIndex(j))
+				{
+					AddReferencedObjectsInValue(Collector, SetProp->ElementProp, Helper.GetElementPtr(j), ReferencingObject);
+				}
+			}
+		}
+		else if (const FMapProperty* MapProp = CastField<const FMapProperty>(Prop))
+		{
+			FScriptMapHelper Helper(MapProp, ElementPtr);
+			for (int32 j = 0; j < Helper.GetMaxIndex(); ++j)
+			{
+				if (Helper.IsValidIndex(j))
+				{
+					AddReferencedObjectsInValue(Collector, MapProp->KeyProp, Helper.GetKeyPtr(j), ReferencingObject);
+					AddReferencedObjectsInValue(Collector, MapProp->ValueProp, Helper.GetValuePtr(j), ReferencingObject);
+				}
+			}
+		}
+	}
+}
+
 bool FMDFastBindingHelpers::DoesClassHaveSuperClassBindings(UWidgetBlueprintGeneratedClass* Class)
 {
 	if (Class != nullptr)
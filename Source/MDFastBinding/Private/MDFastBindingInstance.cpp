@@ -3,11 +3,134 @@
 #include "MDFastBindingInstance.h"
 
 #include "MDFastBindingContainer.h"
+#include "MDFastBindingCostEstimate.h"
 #include "BindingDestinations/MDFastBindingDestinationBase.h"
 #include "BindingValues/MDFastBindingValueBase.h"
 
 #if WITH_EDITOR
+#include "Hash/CityHash.h"
+#include "Serialization/ArchiveUObject.h"
 #include "UObject/ObjectSaveContext.h"
+#include "UObject/UnrealType.h"
+
+namespace MDFastBindingInstance_Private
+{
+	// Hashes an object's saved properties in place of writing them, collecting the structs it references along the way
+	class FValidationHashArchive : public FArchiveUObject
+	{
+	public:
+		FValidationHashArchive()
+		{
+			SetIsSaving(true);
+			SetIsPersistent(true);
+		}
+
+		virtual void Serialize(void* Data, int64 Num) override
+		{
+			Hash = CityHash64WithSeed(static_cast<const char*>(Data), Num, Hash);
+		}
+
+		virtual FArchive& operator<<(FName& Value) override
+		{
+			uint32 NameHash = GetTypeHash(Value);
+			Serialize(&NameHash, sizeof(NameHash));
+			return *this;
+		}
+
+		virtual FArchive& operator<<(UObject*& Value) override
+		{
+			UPTRINT Pointer = reinterpret_cast<UPTRINT>(Value);
+			Serialize(&Pointer, sizeof(Pointer));
+
+			if (const UStruct* Struct = Cast<UStruct>(Value))
+			{
+				ReferencedStructs.Add(Struct);
+			}
+
+			return *this;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("FMDFastBindingValidationHashArchive"); }
+
+		uint64 Hash = 0;
+		TSet<const UStruct*> ReferencedStructs;
+	};
+
+	// Hashes the members of a struct, including the members of the types of its object and struct properties down to Depth,
+	// so renaming or retyping a member that a binding path walks through changes the hash
+	uint64 HashStructLayout(const UStruct* Struct, int32 Depth, TMap<const UStruct*, uint64>& LayoutHashes)
+	{
+		if (Struct == nullptr)
+		{
+			return 0;
+		}
+
+		// Only memoize full depth hashes, which is what bindings ask for
+		constexpr int32 MaxDepth = 1;
+		if (Depth == MaxDepth)
+		{
+			if (const uint64* CachedHash = LayoutHashes.Find(Struct))
+			{
+				return *CachedHash;
+			}
+		}
+
+		uint64 Hash = CityHash64(reinterpret_cast<const char*>(&Struct), sizeof(Struct));
+		auto HashString = [&Hash](const FString& String)
+		{
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(*String), String.Len() * sizeof(TCHAR), Hash);
+		};
+
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			HashString(It->GetName());
+			HashString(It->GetCPPType());
+			const uint64 PropertyFlags = It->PropertyFlags;
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&PropertyFlags), sizeof(PropertyFlags), Hash);
+
+			if (Depth > 0)
+			{
+				const UStruct* PropertyStruct = nullptr;
+				if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(*It))
+				{
+					PropertyStruct = ObjectProp->PropertyClass;
+				}
+				else if (const FStructProperty* StructProp = CastField<FStructProperty>(*It))
+				{
+					PropertyStruct = StructProp->Struct;
+				}
+
+				if (PropertyStruct != nullptr && PropertyStruct != Struct)
+				{
+					const uint64 PropertyStructHash = HashStructLayout(PropertyStruct, Depth - 1, LayoutHashes);
+					Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&PropertyStructHash), sizeof(PropertyStructHash), Hash);
+				}
+			}
+		}
+
+		if (const UClass* Class = Cast<UClass>(Struct))
+		{
+			for (TFieldIterator<UFunction> It(Class); It; ++It)
+			{
+				HashString(It->GetName());
+				const uint32 FunctionFlags = It->FunctionFlags;
+				Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&FunctionFlags), sizeof(FunctionFlags), Hash);
+
+				for (TFieldIterator<FProperty> ParamIt(*It); ParamIt; ++ParamIt)
+				{
+					HashString(ParamIt->GetCPPType());
+				}
+			}
+		}
+
+		if (Depth == MaxDepth)
+		{
+			LayoutHashes.Add(Struct, Hash);
+		}
+
+		return Hash;
+	}
+}
 #endif
 
 UClass* UMDFastBindingInstance::GetBindingOwnerClass() const
@@ -87,6 +210,42 @@ EDataValidationResult UMDFastBindingInstance::IsDataValid(TArray<FText>& Validat
 	return EDataValidationResult::Invalid;
 }
 
+EDataValidationResult UMDFastBindingInstance::IsDataValidCached(TArray<FText>& ValidationErrors, TMap<const UStruct*, uint64>& LayoutHashes)
+{
+	using namespace MDFastBindingInstance_Private;
+
+	// Anything that can change a validation result is either a saved property on one of our nodes
+	// or the layout of the owner class or a class/struct the nodes reference
+	FValidationHashArchive HashArchive;
+	SerializeScriptProperties(HashArchive);
+	for (const UMDFastBindingObject* Object : GatherAllBindingObjects())
+	{
+		if (Object != nullptr)
+		{
+			Object->SerializeScriptProperties(HashArchive);
+		}
+	}
+
+	uint64 CacheKey = HashArchive.Hash;
+	HashArchive.ReferencedStructs.Add(GetBindingOwnerClass());
+	for (const UStruct* Struct : HashArchive.ReferencedStructs)
+	{
+		const uint64 LayoutHash = HashStructLayout(Struct, 1, LayoutHashes);
+		// Order independent since set iteration order isn't stable
+		CacheKey ^= LayoutHash;
+	}
+
+	if (CacheKey != ValidationCacheKey || CachedValidationResult == EDataValidationResult::NotValidated)
+	{
+		CachedValidationErrors.Reset();
+		CachedValidationResult = IsDataValid(CachedValidationErrors);
+		ValidationCacheKey = CacheKey;
+	}
+
+	ValidationErrors.Append(CachedValidationErrors);
+	return CachedValidationResult;
+}
+
 void UMDFastBindingInstance::PreSave(FObjectPreSaveContext SaveContext)
 {
 	Super::PreSave(SaveContext);
@@ -103,6 +262,14 @@ void UMDFastBindingInstance::PostDuplicate(EDuplicateMode::Type DuplicateMode)
 	bIsBindingPerformant = IsBindingPerformant();
 }
 
+void UMDFastBindingInstance::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo can restore any part of the node tree
+	MarkStructureChanged();
+}
+
 void UMDFastBindingInstance::OnVariableRenamed(UClass* VariableClass, const FName& OldVariableName, const FName& NewVariableName)
 {
 	if (BindingDestination != nullptr)
@@ -170,6 +337,44 @@ bool UMDFastBindingInstance::IsBindingPerformant() const
 	return false;
 }
 
+FMDFastBindingCostEstimate UMDFastBindingInstance::EstimateCost() const
+{
+	FMDFastBindingCostEstimate Cost;
+	if (BindingDestination == nullptr)
+	{
+		return Cost;
+	}
+
+	TFunction<void(UMDFastBindingObject*)> AccumulateBindingObjectCost;
+
+	AccumulateBindingObjectCost = [&AccumulateBindingObjectCost, &Cost](UMDFastBindingObject* BindingObject)
+	{
+		if (BindingObject == nullptr)
+		{
+			return;
+		}
+
+		// Once nodes reuse their value after they succeed, so only the node itself is visited each update
+		if (BindingObject->GetUpdateType() == EMDFastBindingUpdateType::Once)
+		{
+			++Cost.NumNodes;
+			return;
+		}
+
+		BindingObject->AccumulateEstimatedCost(Cost);
+
+		for (const FMDFastBindingItem& BindingItem : BindingObject->GetBindingItems())
+		{
+			AccumulateBindingObjectCost(BindingItem.Value);
+		}
+	};
+
+	AccumulateBindingObjectCost(BindingDestination);
+	Cost.bTicks = !IsBindingPerformant();
+
+	return Cost;
+}
+
 int32 UMDFastBindingInstance::GetBindingIndex() const
 {
 #if WITH_EDITORONLY_DATA
@@ -201,6 +406,7 @@ UMDFastBindingValueBase* UMDFastBindingInstance::AddOrphan(UMDFastBindingValueBa
 		Modify();
 		UMDFastBindingValueBase* Value = DuplicateObject(InValue, this);
 		OrphanedValues.Add(Value);
+		MarkStructureChanged();
 		return Value;
 	}
 
@@ -211,6 +417,7 @@ void UMDFastBindingInstance::RemoveOrphan(UMDFastBindingValueBase* InValue)
 {
 	Modify();
 	OrphanedValues.Remove(InValue);
+	MarkStructureChanged();
 }
 
 UMDFastBindingDestinationBase* UMDFastBindingInstance::SetDestination(TSubclassOf<UMDFastBindingDestinationBase> InClass)
@@ -240,6 +447,7 @@ UMDFastBindingDestinationBase* UMDFastBindingInstance::SetDestination(UMDFastBin
 
 	InactiveDestinations.Remove(Destination);
 	BindingDestination = Destination;
+	MarkStructureChanged();
 
 	return BindingDestination;
 }
@@ -254,6 +462,8 @@ void UMDFastBindingInstance::RemoveDestination(UMDFastBindingDestinationBase* In
 	{
 		InactiveDestinations.Remove(InDestination);
 	}
+
+	MarkStructureChanged();
 }
 
 FText UMDFastBindingInstance::GetBindingDisplayName() const
@@ -274,114 +484,73 @@ void UMDFastBindingInstance::SetBindingDisplayName(const FText& InText)
 
 UMDFastBindingObject* UMDFastBindingInstance::FindBindingObjectWithGUID(const FGuid& Guid) const
 {
-	if (GuidToBindingObjectMap.Contains(Guid))
+	if (IndexedStructureVersion != StructureVersion)
 	{
-		if (UMDFastBindingObject* Object = GuidToBindingObjectMap[Guid].Get())
-		{
-			return Object;
-		}
+		RebuildBindingObjectIndex();
 	}
 
-	auto CheckObject = [&](UMDFastBindingObject* Object)
+	if (const TWeakObjectPtr<UMDFastBindingObject>* ObjectPtr = GuidToBindingObjectMap.Find(Guid))
 	{
+		UMDFastBindingObject* Object = ObjectPtr->Get();
 		if (Object != nullptr && Object->BindingObjectIdentifier == Guid)
 		{
-			GuidToBindingObjectMap.Add(Guid, Object);
-			return true;
+			return Object;
 		}
+	}
 
-		return false;
-	};
+	return nullptr;
+}
 
-	// Traverse the tree of nodes connected to BindingDestination
-	if (BindingDestination != nullptr)
+const TArray<UMDFastBindingObject*>& UMDFastBindingInstance::GetAllBindingObjects() const
+{
+	if (IndexedStructureVersion != StructureVersion)
 	{
-		TFunction<UMDFastBindingObject*(UMDFastBindingObject*)> CheckBindingNodeTree;
-
-		CheckBindingNodeTree = [&](UMDFastBindingObject* BindingObject) -> UMDFastBindingObject*
-		{
-			if (BindingObject == nullptr)
-			{
-				return nullptr;
-			}
-
-			if (CheckObject(BindingObject))
-			{
-				return BindingObject;
-			}
+		RebuildBindingObjectIndex();
+	}
 
-			for (const FMDFastBindingItem& BindingItem : BindingObject->GetBindingItems())
-			{
-				if (UMDFastBindingObject* FoundObject = CheckBindingNodeTree(BindingItem.Value))
-				{
-					return FoundObject;
-				}
-			}
+	return AllBindingObjects;
+}
 
-			return nullptr;
-		};
+void UMDFastBindingInstance::RebuildBindingObjectIndex() const
+{
+	AllBindingObjects.Reset();
+	GuidToBindingObjectMap.Reset();
+	IndexedStructureVersion = StructureVersion;
 
-		if (UMDFastBindingObject* FoundObject = CheckBindingNodeTree(BindingDestination))
-		{
-			return FoundObject;
-		}
+	if (BindingDestination != nullptr)
+	{
+		AllBindingObjects.Add(BindingDestination);
 	}
 
-	// Check if the object is an orphan / inactive destination
+	for (UMDFastBindingValueBase* Orphan : OrphanedValues)
 	{
-		for (UMDFastBindingValueBase* Orphan : OrphanedValues)
-		{
-			if (CheckObject(Orphan))
-			{
-				return Orphan;
-			}
-		}
-
-		for (UMDFastBindingDestinationBase* InactiveDestination : InactiveDestinations)
+		if (Orphan != nullptr)
 		{
-			if (CheckObject(InactiveDestination))
-			{
-				return InactiveDestination;
-			}
+			AllBindingObjects.Add(Orphan);
 		}
 	}
 
-	return nullptr;
-}
-
-TArray<UMDFastBindingObject*> UMDFastBindingInstance::GatherAllBindingObjects() const
-{
-	TArray<UMDFastBindingObject*> Result;
-
-	TArray<UMDFastBindingObject*> NextNodes;
-	if (UMDFastBindingDestinationBase* BindingDest = GetBindingDestination())
+	for (UMDFastBindingDestinationBase* Destination : InactiveDestinations)
 	{
-		NextNodes.Add(BindingDest);
+		if (Destination != nullptr)
+		{
+			AllBindingObjects.Add(Destination);
+		}
 	}
-	NextNodes.Append(OrphanedValues);
-	NextNodes.Append(InactiveDestinations);
 
-	while (NextNodes.Num() > 0)
+	// The result doubles as the queue, so the walk is breadth first without shifting the array
+	for (int32 i = 0; i < AllBindingObjects.Num(); ++i)
 	{
-		TArray<UMDFastBindingObject*> CurrentNodes = MoveTemp(NextNodes);
-		NextNodes.Empty();
+		UMDFastBindingObject* Node = AllBindingObjects[i];
+		GuidToBindingObjectMap.Add(Node->BindingObjectIdentifier, Node);
 
-		while (CurrentNodes.Num() > 0)
+		for (const FMDFastBindingItem& Item : Node->GetBindingItems())
 		{
-			UMDFastBindingObject* Node = CurrentNodes[0];
-			CurrentNodes.RemoveAt(0);
-			Result.Add(Node);
-
-			for (const FMDFastBindingItem& Item : Node->GetBindingItems())
+			if (Item.Value != nullptr)
 			{
-				if (Item.Value != nullptr)
-				{
-					NextNodes.Add(Item.Value);
-				}
+				AllBindingObjects.Add(Item.Value);
 			}
 		}
 	}
-
-	return Result;
 }
 #endif
@@ -0,0 +1,297 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingMemoryReport.h"
+
+#include "Algo/Sort.h"
+#include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "BindingValues/MDFastBindingValueBase.h"
+#include "HAL/IConsoleManager.h"
+#include "MDFastBindingContainer.h"
+#include "MDFastBindingInstance.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+
+namespace MDFastBindingMemoryReport_Private
+{
+	struct FBindingUsage
+	{
+		FString BindingName;
+		int32 NumInstances = 0;
+		FMDFastBindingAllocatedMemory Memory;
+	};
+
+	struct FOwnerClassUsage
+	{
+		// Owners with a container per class in their hierarchy are only counted once
+		TSet<const UObject*> Owners;
+		FMDFastBindingAllocatedMemory Memory;
+		// Per source container, indexed like its bindings. An owner class can have several source containers (eg. one per super class).
+		TMap<const UMDFastBindingContainer*, TArray<FBindingUsage>> SourceBindings;
+	};
+
+	struct FCachedValueUsage
+	{
+		SIZE_T NumBytes = 0;
+		FString Description;
+	};
+
+	void GatherNodes_Recursive(UMDFastBindingObject* Object, TArray<UMDFastBindingObject*>& OutNodes)
+	{
+		if (Object == nullptr)
+		{
+			return;
+		}
+
+		OutNodes.Add(Object);
+		for (const FMDFastBindingItem& Item : Object->GetBindingItems())
+		{
+			GatherNodes_Recursive(Item.Value, OutNodes);
+		}
+	}
+
+	// Class level containers (on a class, its CDO or an archetype) are shared and only exist once, so only runtime duplicates are reported
+	bool IsRuntimeContainer(const UMDFastBindingContainer& Container)
+	{
+		return !Container.IsTemplate() && Container.GetTypedOuter<UClass>() == nullptr;
+	}
+
+	FString FormatMemory(const FMDFastBindingAllocatedMemory& Memory)
+	{
+		return FString::Printf(TEXT("%s in %d allocations"), *FText::AsMemory(Memory.NumBytes).ToString(), Memory.NumAllocations);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("MDFastBinding.MemReport"),
+		TEXT("Logs the memory held by runtime bindings per owner class and per binding, and the largest cached values. Usage: MDFastBinding.MemReport [NumLargestValues]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+		{
+			const int32 NumLargestValues = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10;
+			FMDFastBindingMemoryReport::Report(Ar, FMath::Max(0, NumLargestValues));
+		}));
+}
+
+void FMDFastBindingAllocatedMemory::AddPropertyValue(const FProperty* Property, const void* ValuePtr)
+{
+	if (Property != nullptr && ValuePtr != nullptr)
+	{
+		AddAllocation(Property->GetSize());
+		AddNestedAllocations(Property, ValuePtr);
+	}
+}
+
+void FMDFastBindingAllocatedMemory::AddNestedAllocations(const FProperty* Property, const void* ValuePtr)
+{
+	if (Property == nullptr || ValuePtr == nullptr)
+	{
+		return;
+	}
+
+	// Container sizes are estimated from their elements, slack and hash buckets aren't included
+	if (Property->IsA<FStrProperty>())
+	{
+		const SIZE_T AllocatedSize = static_cast<const FString*>(ValuePtr)->GetAllocatedSize();
+		if (AllocatedSize > 0)
+		{
+			AddAllocation(AllocatedSize);
+		}
+	}
+	else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
+		{
+			for (int32 i = 0; i < It->ArrayDim; ++i)
+			{
+				AddNestedAllocations(*It, It->ContainerPtrToValuePtr<void>(ValuePtr, i));
+			}
+		}
+	}
+	else if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+		if (Helper.Num() > 0)
+		{
+			AddAllocation(Helper.Num() * ArrayProp->Inner->GetSize());
+			for (int32 i = 0; i < Helper.Num(); ++i)
+			{
+				AddNestedAllocations(ArrayProp->Inner, Helper.GetRawPtr(i));
+			}
+		}
+	}
+	else if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, ValuePtr);
+		if (Helper.Num() > 0)
+		{
+			AddAllocation(Helper.GetMaxIndex() * SetProp->ElementProp->GetSize());
+			for (int32 i = 0; i < Helper.GetMaxIndex(); ++i)
+			{
+				if (Helper.IsValidIndex(i))
+				{
+					AddNestedAllocations(SetProp->ElementProp, Helper.GetElementPtr(i));
+				}
+			}
+		}
+	}
+	else if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProp, ValuePtr);
+		if (Helper.Num() > 0)
+		{
+			AddAllocation(Helper.GetMaxIndex() * (MapProp->KeyProp->GetSize() + MapProp->ValueProp->GetSize()));
+			for (int32 i = 0; i < Helper.GetMaxIndex(); ++i)
+			{
+				if (Helper.IsValidIndex(i))
+				{
+					AddNestedAllocations(MapProp->KeyProp, Helper.GetKeyPtr(i));
+					AddNestedAllocations(MapProp->ValueProp, Helper.GetValuePtr(i));
+				}
+			}
+		}
+	}
+}
+
+void FMDFastBindingMemoryReport::Report(FOutputDevice& Ar, int32 NumLargestValues)
+{
+	using namespace MDFastBindingMemoryReport_Private;
+
+	TMap<const UClass*, FOwnerClassUsage> OwnerClasses;
+	TArray<FCachedValueUsage> CachedValues;
+	FMDFastBindingAllocatedMemory TotalMemory;
+	TArray<UMDFastBindingObject*> Nodes;
+
+	for (TObjectIterator<UMDFastBindingContainer> It; It; ++It)
+	{
+		const UMDFastBindingContainer* Container = *It;
+		if (!IsRuntimeContainer(*Container))
+		{
+			continue;
+		}
+
+		const UClass* OwnerClass = Container->GetBindingOwnerClass();
+		FOwnerClassUsage& OwnerUsage = OwnerClasses.FindOrAdd(OwnerClass);
+		OwnerUsage.Owners.Add(Container->GetOuter());
+		OwnerUsage.Memory.AddAllocation(Container->GetClass()->GetStructureSize());
+
+		const UMDFastBindingContainer* SourceContainer = Container->SourceContainer.Get();
+		const UClass* SourceOwnerClass = SourceContainer != nullptr ? SourceContainer->GetBindingOwnerClass() : nullptr;
+		TArray<FBindingUsage>& SourceBindings = OwnerUsage.SourceBindings.FindOrAdd(SourceContainer);
+
+		const TArray<UMDFastBindingInstance*>& Bindings = Container->GetBindings();
+		if (SourceBindings.Num() < Bindings.Num())
+		{
+			SourceBindings.SetNum(Bindings.Num());
+		}
+
+		for (int32 BindingIdx = 0; BindingIdx < Bindings.Num(); ++BindingIdx)
+		{
+			const UMDFastBindingInstance* Binding = Bindings[BindingIdx];
+			if (Binding == nullptr)
+			{
+				continue;
+			}
+
+			FBindingUsage& BindingUsage = SourceBindings[BindingIdx];
+			if (BindingUsage.NumInstances++ == 0)
+			{
+#if WITH_EDITORONLY_DATA
+				BindingUsage.BindingName = Binding->GetBindingDisplayName().ToString();
+#else
+				BindingUsage.BindingName = Binding->GetName();
+#endif
+				// Tell super class bindings apart from the owner class's own bindings
+				if (SourceOwnerClass != nullptr && SourceOwnerClass != OwnerClass)
+				{
+					BindingUsage.BindingName = FString::Printf(TEXT("%s.%s"), *SourceOwnerClass->GetName(), *BindingUsage.BindingName);
+				}
+			}
+
+			BindingUsage.Memory.AddAllocation(Binding->GetClass()->GetStructureSize());
+
+			Nodes.Reset();
+			GatherNodes_Recursive(Binding->GetBindingDestination(), Nodes);
+			for (UMDFastBindingObject* Node : Nodes)
+			{
+				BindingUsage.Memory.AddAllocation(Node->GetClass()->GetStructureSize());
+				Node->AccumulateAllocatedMemory(BindingUsage.Memory);
+
+				const UMDFastBindingValueBase* Value = Cast<UMDFastBindingValueBase>(Node);
+				if (Value != nullptr && Value->HasCachedValue() && !Value->IsCachedValueBorrowed())
+				{
+					const TTuple<const FProperty*, void*> CachedValue = Value->GetCachedValue();
+					FMDFastBindingAllocatedMemory ValueMemory;
+					ValueMemory.AddPropertyValue(CachedValue.Key, CachedValue.Value);
+					CachedValues.Add({ ValueMemory.NumBytes, FString::Printf(TEXT("%s (%s) in %s / %s"),
+						*CachedValue.Key->GetCPPType(), *Node->GetClass()->GetName(), *GetNameSafe(OwnerClass), *BindingUsage.BindingName) });
+				}
+			}
+		}
+	}
+
+	Ar.Logf(TEXT("MDFastBinding memory report"));
+
+	TArray<const UClass*> SortedClasses;
+	TMap<const UClass*, TArray<FBindingUsage>> ClassBindings;
+	for (TPair<const UClass*, FOwnerClassUsage>& Pair : OwnerClasses)
+	{
+		TArray<FBindingUsage>& Bindings = ClassBindings.Add(Pair.Key);
+		for (TPair<const UMDFastBindingContainer*, TArray<FBindingUsage>>& SourcePair : Pair.Value.SourceBindings)
+		{
+			for (FBindingUsage& BindingUsage : SourcePair.Value)
+			{
+				Pair.Value.Memory += BindingUsage.Memory;
+				if (BindingUsage.NumInstances > 0)
+				{
+					Bindings.Add(MoveTemp(BindingUsage));
+				}
+			}
+		}
+
+		TotalMemory += Pair.Value.Memory;
+		SortedClasses.Add(Pair.Key);
+	}
+
+	// Algo::Sort doesn't dereference the pointers, the owner class can be null
+	Algo::Sort(SortedClasses, [&OwnerClasses](const UClass* A, const UClass* B)
+	{
+		return OwnerClasses[A].Memory.NumBytes > OwnerClasses[B].Memory.NumBytes;
+	});
+
+	for (const UClass* OwnerClass : SortedClasses)
+	{
+		const FOwnerClassUsage& OwnerUsage = OwnerClasses[OwnerClass];
+		Ar.Logf(TEXT("  %s: %d owners, %s"), *GetNameSafe(OwnerClass), OwnerUsage.Owners.Num(), *FormatMemory(OwnerUsage.Memory));
+
+		TArray<FBindingUsage>& Bindings = ClassBindings[OwnerClass];
+		Bindings.Sort([](const FBindingUsage& A, const FBindingUsage& B)
+		{
+			return A.Memory.NumBytes > B.Memory.NumBytes;
+		});
+
+		for (const FBindingUsage& BindingUsage : Bindings)
+		{
+			Ar.Logf(TEXT("    %s: %d instances, %s"), *BindingUsage.BindingName, BindingUsage.NumInstances, *FormatMemory(BindingUsage.Memory));
+		}
+	}
+
+	FMDFastBindingAllocatedMemory SharedDefaultMemory;
+	FMDFastBindingItemDefaultValue::AccumulateSharedMemory(SharedDefaultMemory);
+	TotalMemory += SharedDefaultMemory;
+	Ar.Logf(TEXT("  Shared default values: %s"), *FormatMemory(SharedDefaultMemory));
+
+	if (NumLargestValues > 0 && CachedValues.Num() > 0)
+	{
+		CachedValues.Sort([](const FCachedValueUsage& A, const FCachedValueUsage& B)
+		{
+			return A.NumBytes > B.NumBytes;
+		});
+
+		Ar.Logf(TEXT("  Largest cached values:"));
+		for (int32 i = 0; i < FMath::Min(NumLargestValues, CachedValues.Num()); ++i)
+		{
+			Ar.Logf(TEXT("    %s %s"), *FText::AsMemory(CachedValues[i].NumBytes).ToString(), *CachedValues[i].Description);
+		}
+	}
+
+	Ar.Logf(TEXT("  Total: %d owner classes, %s"), OwnerClasses.Num(), *FormatMemory(TotalMemory));
+}
@@ -0,0 +1,51 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingNodeStats.h"
+
+#if WITH_EDITORONLY_DATA
+namespace MDFastBindingNodeStats_Private
+{
+	// Bindings update on the game thread, so only one chain of nested scopes can be open at a time
+	FMDFastBindingNodeStatsScope* CurrentScope = nullptr;
+}
+
+bool FMDFastBindingNodeStats::bIsRecording = false;
+
+FMDFastBindingNodeStatsScope::FMDFastBindingNodeStatsScope(FMDFastBindingNodeStats& InStats)
+{
+	if (FMDFastBindingNodeStats::IsRecording() && IsInGameThread())
+	{
+		Stats = &InStats;
+		OuterScope = MDFastBindingNodeStats_Private::CurrentScope;
+		MDFastBindingNodeStats_Private::CurrentScope = this;
+		StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+FMDFastBindingNodeStatsScope::~FMDFastBindingNodeStatsScope()
+{
+	if (Stats == nullptr)
+	{
+		return;
+	}
+
+	const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+	++Stats->NumEvaluations;
+	Stats->ExclusiveCycles += ElapsedCycles > InnerCycles ? ElapsedCycles - InnerCycles : 0;
+
+	if (OuterScope != nullptr)
+	{
+		OuterScope->InnerCycles += ElapsedCycles;
+	}
+
+	MDFastBindingNodeStats_Private::CurrentScope = OuterScope;
+}
+
+void FMDFastBindingNodeStatsScope::MarkChanged()
+{
+	if (Stats != nullptr)
+	{
+		++Stats->NumChanges;
+	}
+}
+#endif
@@ -4,8 +4,14 @@
 
 #include "MDFastBinding.h"
 #include "MDFastBindingContainer.h"
+#include "MDFastBindingCostEstimate.h"
+#include "MDFastBindingDirtyQueue.h"
 #include "MDFastBindingHelpers.h"
 #include "MDFastBindingInstance.h"
+#include "MDFastBindingMemoryReport.h"
+#include "MDFastBindingRecorder.h"
+#include "MDFastBindingStats.h"
+#include "MDFastBindingTrace.h"
 #include "BindingValues/MDFastBindingValueBase.h"
 #include "UObject/ObjectSaveContext.h"
 #include "UObject/TextProperty.h"
@@ -19,12 +25,88 @@
 
 #define LOCTEXT_NAMESPACE "MDFastBindingObject"
 
+namespace MDFastBindingObject_Private
+{
+	// Only touched on the game thread, other threads go through FMDFastBindingDirtyQueue
+	uint64 DirtyEpochCounter = 0;
+
+	// Values remove themselves when the last item releases them
+	struct FSharedDefaultValue
+	{
+		TWeakFieldPtr<const FProperty> Property;
+		FMDFastBindingItemDefaultValue* Value = nullptr;
+	};
+
+	TMap<TTuple<const FProperty*, FString>, FSharedDefaultValue> SharedDefaultValues;
+}
+
+FMDFastBindingItemDefaultValue::FMDFastBindingItemDefaultValue(const FProperty* InProperty, TFunctionRef<void(void*)> InitializeValue)
+	: Property(InProperty)
+{
+	LLM_SCOPE_BYTAG(MDFastBinding);
+
+	Value = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(Value);
+	InitializeValue(Value);
+}
+
+FMDFastBindingItemDefaultValue::~FMDFastBindingItemDefaultValue()
+{
+	if (bIsShared)
+	{
+		using namespace MDFastBindingObject_Private;
+
+		const TTuple<const FProperty*, FString> Key = TTuple<const FProperty*, FString>(Property, SharedDefaultString);
+		const FSharedDefaultValue* SharedValue = SharedDefaultValues.Find(Key);
+		// A value for a destroyed property may have been replaced by one for a new property at the same address
+		if (SharedValue != nullptr && SharedValue->Value == this)
+		{
+			SharedDefaultValues.Remove(Key);
+		}
+	}
+
+	Property->DestroyValue(Value);
+	FMemory::Free(Value);
+}
+
+TRefCountPtr<FMDFastBindingItemDefaultValue> FMDFastBindingItemDefaultValue::FindOrImportShared(const FProperty* InProperty, const FString& DefaultString)
+{
+	using namespace MDFastBindingObject_Private;
+
+	LLM_SCOPE_BYTAG(MDFastBinding);
+
+	const TTuple<const FProperty*, FString> Key = TTuple<const FProperty*, FString>(InProperty, DefaultString);
+	const FSharedDefaultValue* ExistingValue = SharedDefaultValues.Find(Key);
+	// The property could have been destroyed and another allocated in its place
+	if (ExistingValue != nullptr && ExistingValue->Property.Get() == InProperty)
+	{
+		return ExistingValue->Value;
+	}
 
-FMDFastBindingItem::~FMDFastBindingItem()
+	FMDFastBindingItemDefaultValue* NewValue = new FMDFastBindingItemDefaultValue(InProperty, [InProperty, &DefaultString](void* ValuePtr)
+	{
+		InProperty->ImportText_Direct(*DefaultString, ValuePtr, nullptr, PPF_None);
+	});
+	NewValue->SharedDefaultString = DefaultString;
+	NewValue->bIsShared = true;
+	FSharedDefaultValue& SharedValue = SharedDefaultValues.Add(Key);
+	SharedValue.Property = InProperty;
+	SharedValue.Value = NewValue;
+
+	return NewValue;
+}
+
+void FMDFastBindingItemDefaultValue::AccumulateSharedMemory(FMDFastBindingAllocatedMemory& InOutMemory)
 {
-	if (AllocatedDefaultValue != nullptr)
+	InOutMemory.AddAllocation(MDFastBindingObject_Private::SharedDefaultValues.GetAllocatedSize());
+	for (const TPair<TTuple<const FProperty*, FString>, MDFastBindingObject_Private::FSharedDefaultValue>& Pair : MDFastBindingObject_Private::SharedDefaultValues)
 	{
-		FMemory::Free(AllocatedDefaultValue);
+		const FMDFastBindingItemDefaultValue* DefaultValue = Pair.Value.Value;
+		if (DefaultValue != nullptr && Pair.Value.Property.Get() == DefaultValue->Property)
+		{
+			InOutMemory.AddAllocation(sizeof(FMDFastBindingItemDefaultValue) + DefaultValue->SharedDefaultString.GetAllocatedSize());
+			InOutMemory.AddPropertyValue(DefaultValue->Property, DefaultValue->Value);
+		}
 	}
 }
 
@@ -46,21 +128,22 @@ TTuple<const FProperty*, void*> FMDFastBindingItem::GetValue(UObject* SourceObje
 
 	{
 		const FProperty* EffectiveItemProp = ItemProperty.IsValid() ? ItemProperty.Get() : UMDFastBindingProperties::GetObjectProperty();
-		if (AllocatedDefaultValue != nullptr)
+		if (DefaultValue.IsValid())
 		{
-			return TTuple<const FProperty*, void*>{ EffectiveItemProp, AllocatedDefaultValue };
+			return GetDefaultValue();
 		}
 
 		if (IsSelfPin() || IsWorldContextPin())
 		{
 			bHasRetrievedDefaultValue = true;
 			UObject** SourceObjectPtr = &SourceObject;
-			AllocatedDefaultValue = FMemory::Malloc(EffectiveItemProp->GetSize(), EffectiveItemProp->GetMinAlignment());
-			EffectiveItemProp->InitializeValue(AllocatedDefaultValue);
-			EffectiveItemProp->CopyCompleteValue(AllocatedDefaultValue, SourceObjectPtr);
+			DefaultValue = new FMDFastBindingItemDefaultValue(EffectiveItemProp, [EffectiveItemProp, SourceObjectPtr](void* ValuePtr)
+			{
+				EffectiveItemProp->CopyCompleteValue(ValuePtr, SourceObjectPtr);
+			});
 			OutDidUpdate = true;
 
-			return TTuple<const FProperty*, void*>{ EffectiveItemProp, AllocatedDefaultValue };
+			return GetDefaultValue();
 		}
 	}
 
@@ -90,23 +173,40 @@ TTuple<const FProperty*, void*> FMDFastBindingItem::GetValue(UObject* SourceObje
 	else if (const FObjectPropertyBase* ObjectProp = CastField<const FObjectPropertyBase>(ItemProp))
 	{
 		bHasRetrievedDefaultValue = true;
-		AllocatedDefaultValue = FMemory::Malloc(ObjectProp->GetSize(), ObjectProp->GetMinAlignment());
-		ObjectProp->InitializeValue(AllocatedDefaultValue);
-		ObjectProp->SetObjectPropertyValue(AllocatedDefaultValue, DefaultObject);
-		return TTuple<const FProperty*, void*>{ ObjectProp, AllocatedDefaultValue };
+		DefaultValue = new FMDFastBindingItemDefaultValue(ObjectProp, [ObjectProp, this](void* ValuePtr)
+		{
+			ObjectProp->SetObjectPropertyValue(ValuePtr, DefaultObject);
+		});
+		return GetDefaultValue();
 	}
 	else if (!DefaultString.IsEmpty())
 	{
 		bHasRetrievedDefaultValue = true;
-		AllocatedDefaultValue = FMemory::Malloc(ItemProp->GetSize(), ItemProp->GetMinAlignment());
-		ItemProp->InitializeValue(AllocatedDefaultValue);
-		ItemProp->ImportText_Direct(*DefaultString, AllocatedDefaultValue, nullptr, PPF_None);
-		return TTuple<const FProperty*, void*>{ ItemProp, AllocatedDefaultValue };
+		DefaultValue = FMDFastBindingItemDefaultValue::FindOrImportShared(ItemProp, DefaultString);
+#if !WITH_EDITORONLY_DATA
+		// Nothing reads the string again once it's imported outside of the editor
+		DefaultString.Empty();
+#endif
+		return GetDefaultValue();
 	}
 
 	return {};
 }
 
+TTuple<const FProperty*, void*> FMDFastBindingItem::GetDefaultValue() const
+{
+	return TTuple<const FProperty*, void*>{ DefaultValue->GetProperty(), const_cast<void*>(DefaultValue->GetValuePtr()) };
+}
+
+void FMDFastBindingItem::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	if (DefaultValue.IsValid() && !DefaultValue->IsShared())
+	{
+		InOutMemory.AddAllocation(sizeof(FMDFastBindingItemDefaultValue));
+		InOutMemory.AddPropertyValue(DefaultValue->GetProperty(), DefaultValue->GetValuePtr());
+	}
+}
+
 const FProperty* FMDFastBindingItem::ResolveOutputProperty() const
 {
 	if (const FProperty* Prop = ItemProperty.Get())
@@ -135,12 +235,9 @@ TTuple<const FProperty*, void*> FMDFastBindingItem::GetCachedValue() const
 		return Value->GetCachedValue();
 	}
 
-	if (const FProperty* ItemProp = ItemProperty.Get())
+	if (ItemProperty.IsValid() && DefaultValue.IsValid())
 	{
-		if (AllocatedDefaultValue != nullptr)
-		{
-			return TTuple<const FProperty*, void*>{ ItemProp, AllocatedDefaultValue };
-		}
+		return GetDefaultValue();
 	}
 
 	return {};
@@ -175,6 +272,23 @@ void UMDFastBindingObject::PreSave(FObjectPreSaveContext SaveContext)
 #endif
 }
 
+void UMDFastBindingObject::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	FMDFastBindingAllocatedMemory Memory;
+	AccumulateAllocatedMemory(Memory);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Memory.NumBytes);
+}
+
+void UMDFastBindingObject::AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const
+{
+	for (const FMDFastBindingItem& BindingItem : BindingItems)
+	{
+		BindingItem.AccumulateAllocatedMemory(InOutMemory);
+	}
+}
+
 UClass* UMDFastBindingObject::GetBindingOwnerClass() const
 {
 #if !WITH_EDITOR
@@ -289,6 +403,12 @@ bool UMDFastBindingObject::CheckNeedsUpdate() const
 		return false;
 	}
 
+	if (bIsDirtyPropagationInitialized)
+	{
+		// Inputs push their changes to us, polled inputs included once PollInputs has updated them
+		return DirtyEpoch > CleanEpoch || (bSubtreePolls && bUpdateWhenInputsArePolled);
+	}
+
 	for (const FMDFastBindingItem& Item : BindingItems)
 	{
 		if (Item.Value != nullptr && Item.Value->CheckCachedNeedsUpdate())
@@ -350,6 +470,14 @@ void UMDFastBindingObject::MarkObjectDirty()
 	check(UpdateType == EMDFastBindingUpdateType::EventBased);
 
 	bIsObjectDirty = true;
+	MarkPathDirty();
+
+#if MDFASTBINDING_RECORDING_ENABLED
+	if (FMDFastBindingRecorder::IsRecording())
+	{
+		FMDFastBindingRecorder::RecordDirty(*this);
+	}
+#endif
 
 	if (UMDFastBindingInstance* BindingInstance = GetOuterBinding())
 	{
@@ -357,11 +485,136 @@ void UMDFastBindingObject::MarkObjectDirty()
 	}
 }
 
+void UMDFastBindingObject::MarkObjectDirty_AnyThread()
+{
+	if (IsInGameThread())
+	{
+		// Only event based objects can be marked dirty, the others update on their own
+		if (UpdateType == EMDFastBindingUpdateType::EventBased)
+		{
+			MarkObjectDirty();
+		}
+	}
+	else if (!bIsQueuedAsDirty.exchange(true))
+	{
+		// Only queue once until the game thread drains the queue, no matter how many times the producer fires
+		FMDFastBindingDirtyQueue::Enqueue(ThreadSafeWeakThis);
+	}
+}
+
+void UMDFastBindingObject::MarkDequeuedObjectDirty()
+{
+	// Clear before marking dirty so that changes made from now on queue the object again
+	bIsQueuedAsDirty = false;
+
+	if (UpdateType == EMDFastBindingUpdateType::EventBased)
+	{
+		MarkObjectDirty();
+	}
+}
+
 void UMDFastBindingObject::MarkObjectClean()
 {
 	bIsObjectDirty = false;
+	CleanEpoch = UpdateStartEpoch;
 }
 
+void UMDFastBindingObject::MarkPathDirty()
+{
+	const uint64 Epoch = ++MDFastBindingObject_Private::DirtyEpochCounter;
+	for (UMDFastBindingObject* Object = this; Object != nullptr; Object = Object->DownstreamObject)
+	{
+		// Once nodes that have run won't update again, so nothing past them needs to know
+		if (Object->UpdateType == EMDFastBindingUpdateType::Once && Object->HasRunSuccessfully())
+		{
+			break;
+		}
+
+		Object->DirtyEpoch = Epoch;
+		Object->CachedNeedsUpdate = TFrameValue<bool>();
+	}
+}
+
+void UMDFastBindingObject::InitializeDirtyPropagation()
+{
+	bSubtreePolls = UpdateType == EMDFastBindingUpdateType::Always;
+	for (const FMDFastBindingItem& Item : BindingItems)
+	{
+		if (UMDFastBindingObject* Value = Item.Value)
+		{
+			Value->DownstreamObject = this;
+			bSubtreePolls |= Value->bSubtreePolls;
+		}
+	}
+
+	// Once nodes stop caring about their inputs after their first successful update, until then failed updates keep their path dirty
+	if (UpdateType == EMDFastBindingUpdateType::Once)
+	{
+		bSubtreePolls = false;
+	}
+
+	bIsDirtyPropagationInitialized = true;
+}
+
+void UMDFastBindingObject::BeginUpdate()
+{
+	UpdateStartEpoch = MDFastBindingObject_Private::DirtyEpochCounter;
+}
+
+void UMDFastBindingObject::PollInputs(UObject* SourceObject)
+{
+	// Always nodes update anyway, and pull their inputs when they do
+	if (!bSubtreePolls || UpdateType == EMDFastBindingUpdateType::Always)
+	{
+		return;
+	}
+
+	for (const FMDFastBindingItem& Item : BindingItems)
+	{
+		UMDFastBindingValueBase* Value = Item.Value;
+		if (Value != nullptr && Value->bSubtreePolls)
+		{
+			bool bDidUpdate = false;
+			Value->GetValue(SourceObject, bDidUpdate);
+		}
+	}
+}
+
+void UMDFastBindingObject::FinishPolledUpdate(bool bDidChange)
+{
+	if (bDidChange && DownstreamObject != nullptr)
+	{
+		DownstreamObject->MarkPathDirty();
+	}
+
+	// The node that polled us reads our value again when it updates, that shouldn't run us twice
+	CachedNeedsUpdate = false;
+}
+
+#if CPUPROFILERTRACE_ENABLED
+uint32 UMDFastBindingObject::GetTraceSpecId() const
+{
+	if (TraceSpecId == 0)
+	{
+		FString BindingName;
+		if (const UMDFastBindingInstance* Binding = GetOuterBinding())
+		{
+#if WITH_EDITORONLY_DATA
+			BindingName = Binding->BindingName;
+#endif
+			if (BindingName.IsEmpty())
+			{
+				BindingName = Binding->GetName();
+			}
+		}
+
+		TraceSpecId = FMDFastBindingTrace::GetEventType(FString::Printf(TEXT("%s.%s: %s"), *GetNameSafe(GetBindingOwnerClass()), *BindingName, *GetName()));
+	}
+
+	return TraceSpecId;
+}
+#endif
+
 bool UMDFastBindingObject::CheckCachedNeedsUpdate() const
 {
 	if (!CachedNeedsUpdate.IsSet())
@@ -395,6 +648,13 @@ FMDFastBindingItem* UMDFastBindingObject::FindBindingItem(const FName& ItemName)
 	return BindingItems.FindByKey(ItemName);
 }
 
+void UMDFastBindingObject::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	ThreadSafeWeakThis = this;
+}
+
 void UMDFastBindingObject::PostLoad()
 {
 	Super::PostLoad();
@@ -432,7 +692,9 @@ FMDFastBindingItem& UMDFastBindingObject::EnsureBindingItemExists(const FName& I
 #endif
 	BindingItem->bAllowNullValue = bIsOptional;
 	BindingItem->ItemProperty = ItemProperty;
+#if WITH_EDITORONLY_DATA
 	BindingItem->ToolTip = ItemDescription;
+#endif
 
 	return *BindingItem;
 }
@@ -540,6 +802,18 @@ void UMDFastBindingObject::PostEditChangeProperty(FPropertyChangedEvent& Propert
 	SetupBindingItems_Internal();
 }
 
+void UMDFastBindingObject::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	MarkBindingStructureChanged();
+}
+
+void UMDFastBindingObject::AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost)
+{
+	++InOutCost.NumNodes;
+}
+
 TSharedRef<SWidget> UMDFastBindingObject::CreateNodeHeaderWidget()
 {
 	return SNew(STextBlock).Text(TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateUObject(this, &UMDFastBindingObject::GetDisplayName)));
@@ -605,6 +879,7 @@ UMDFastBindingValueBase* UMDFastBindingObject::SetBindingItem_Internal(const FNa
 
 		BindingItem->Value = InValue;
 		BindingItem->ClearDefaultValues();
+		MarkBindingStructureChanged();
 		return InValue;
 	}
 
@@ -618,6 +893,7 @@ void UMDFastBindingObject::ClearBindingItemValue(const FName& ItemName)
 		Modify();
 		BindingItem->Value = nullptr;
 		BindingItem->ClearDefaultValues();
+		MarkBindingStructureChanged();
 	}
 }
 
@@ -627,6 +903,8 @@ void UMDFastBindingObject::ClearBindingItemValuePtrs()
 	{
 		BindingItem.Value = nullptr;
 	}
+
+	MarkBindingStructureChanged();
 }
 
 void UMDFastBindingObject::GatherBindingValues(TArray<UMDFastBindingValueBase*>& OutValues) const
@@ -669,6 +947,16 @@ void UMDFastBindingObject::OrphanAllBindingItems(const TSet<UObject*>& OrphanExc
 			Item.Value = nullptr;
 		}
 	}
+
+	MarkBindingStructureChanged();
+}
+
+void UMDFastBindingObject::MarkBindingStructureChanged() const
+{
+	if (UMDFastBindingInstance* Binding = GetOuterBinding())
+	{
+		Binding->MarkStructureChanged();
+	}
 }
 #endif
 
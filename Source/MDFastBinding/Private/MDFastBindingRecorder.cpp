@@ -0,0 +1,560 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingRecorder.h"
+
+#if MDFASTBINDING_RECORDING_ENABLED
+#include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "BindingValues/MDFastBindingValueBase.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "MDFastBindingContainer.h"
+#include "MDFastBindingInstance.h"
+#include "MDFastBindingLog.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+
+namespace MDFastBindingRecorder_Private
+{
+	constexpr uint32 FileMagic = 0x4D444642; // MDFB
+	constexpr int32 FileVersion = 1;
+
+	enum class ERecordType : uint8
+	{
+		// NodeId, owner class path, source container path, container instance id, binding index, node index
+		Node,
+		// NodeId, exported value text
+		Value,
+		// NodeId
+		Dirty,
+		// End of an engine frame
+		Frame
+	};
+
+	struct FNodeKey
+	{
+		FString OwnerClassPath;
+		FString ContainerPath;
+		uint32 InstanceId = 0;
+		int32 BindingIndex = INDEX_NONE;
+		int32 NodeIndex = INDEX_NONE;
+	};
+
+	TMap<TObjectKey<UMDFastBindingObject>, uint32> RecordedNodeIds;
+	TMap<TObjectKey<UMDFastBindingContainer>, uint32> RecordedInstanceIds;
+	FDelegateHandle EndFrameHandle;
+
+	void GatherNodes_Recursive(UMDFastBindingObject* Object, TArray<UMDFastBindingObject*>& OutNodes)
+	{
+		if (Object == nullptr)
+		{
+			return;
+		}
+
+		OutNodes.Add(Object);
+		for (const FMDFastBindingItem& Item : Object->GetBindingItems())
+		{
+			GatherNodes_Recursive(Item.Value, OutNodes);
+		}
+	}
+
+	void Serialize(FArchive& Ar, FNodeKey& Key)
+	{
+		Ar << Key.OwnerClassPath;
+		Ar << Key.ContainerPath;
+		Ar.SerializeIntPacked(Key.InstanceId);
+		Ar << Key.BindingIndex;
+		Ar << Key.NodeIndex;
+	}
+
+	FAutoConsoleCommand StartRecordingCommand(
+		TEXT("MDFastBinding.Record.Start"),
+		TEXT("Starts recording binding source values and dirty events. Usage: MDFastBinding.Record.Start [FilePath]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString FilePath = Args.Num() > 0
+				? Args[0]
+				: FPaths::ProfilingDir() / TEXT("MDFastBinding") / FString::Printf(TEXT("Recording-%s.mdfbrec"), *FDateTime::Now().ToString());
+			FMDFastBindingRecorder::StartRecording(FilePath);
+		}));
+
+	FAutoConsoleCommand StopRecordingCommand(
+		TEXT("MDFastBinding.Record.Stop"),
+		TEXT("Stops the active binding recording"),
+		FConsoleCommandDelegate::CreateStatic(&FMDFastBindingRecorder::StopRecording));
+
+	FAutoConsoleCommand ReplayCommand(
+		TEXT("MDFastBinding.Replay"),
+		TEXT("Replays a binding recording against stand-in owners and logs the update cost. Usage: MDFastBinding.Replay FilePath [Iterations]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Num() == 0)
+			{
+				UE_LOG(LogMDFastBinding, Error, TEXT("MDFastBinding.Replay requires the path to a recording"));
+				return;
+			}
+
+			const int32 NumIterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1;
+			FMDFastBindingReplay::FResult Result;
+			if (FMDFastBindingReplay::Run(Args[0], NumIterations, Result))
+			{
+				UE_LOG(LogMDFastBinding, Display, TEXT("Replayed [%s]: %d containers, %d frames x %d iterations, initialize %.1f us, average %.2f us/frame, max %.2f us/frame"),
+					*Args[0], Result.NumContainers, Result.NumFrames, Result.NumIterations, Result.InitializeMicroseconds, Result.AverageMicrosecondsPerFrame, Result.MaxMicrosecondsPerFrame);
+			}
+		}));
+}
+
+FArchive* FMDFastBindingRecorder::Writer = nullptr;
+
+bool FMDFastBindingRecorder::StartRecording(const FString& FilePath)
+{
+	using namespace MDFastBindingRecorder_Private;
+
+	if (!IsInGameThread())
+	{
+		return false;
+	}
+
+	StopRecording();
+
+	Writer = IFileManager::Get().CreateFileWriter(*FilePath);
+	if (Writer == nullptr)
+	{
+		UE_LOG(LogMDFastBinding, Error, TEXT("Failed to open [%s] for binding recording"), *FilePath);
+		return false;
+	}
+
+	uint32 Magic = FileMagic;
+	int32 Version = FileVersion;
+	*Writer << Magic;
+	*Writer << Version;
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FMDFastBindingRecorder::OnEndFrame);
+
+	// Values that were already resolved before recording started won't report an update until they change,
+	// so snapshot them up front to give the replay its starting state
+	for (TObjectIterator<UMDFastBindingValueBase> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+	{
+		if (It->CachedValue.Key != nullptr && It->CachedValue.Value != nullptr && IsSourceNode(**It))
+		{
+			uint32 NodeId = 0;
+			if (TryGetNodeId(**It, NodeId))
+			{
+				WriteValue(NodeId, It->CachedValue.Key, It->CachedValue.Value);
+			}
+		}
+	}
+
+	UE_LOG(LogMDFastBinding, Display, TEXT("Recording bindings to [%s]"), *FilePath);
+	return true;
+}
+
+void FMDFastBindingRecorder::StopRecording()
+{
+	using namespace MDFastBindingRecorder_Private;
+
+	if (Writer == nullptr)
+	{
+		return;
+	}
+
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	Writer->Close();
+	delete Writer;
+	Writer = nullptr;
+
+	UE_LOG(LogMDFastBinding, Display, TEXT("Recorded %d binding nodes across %d containers"), RecordedNodeIds.Num(), RecordedInstanceIds.Num());
+
+	RecordedNodeIds.Reset();
+	RecordedInstanceIds.Reset();
+}
+
+void FMDFastBindingRecorder::RecordValue(const UMDFastBindingValueBase& Value)
+{
+	if (!IsRecording() || !IsInGameThread() || !IsSourceNode(Value))
+	{
+		return;
+	}
+
+	uint32 NodeId = 0;
+	if (TryGetNodeId(Value, NodeId))
+	{
+		WriteValue(NodeId, Value.CachedValue.Key, Value.CachedValue.Value);
+	}
+}
+
+void FMDFastBindingRecorder::RecordDirty(const UMDFastBindingObject& Object)
+{
+	if (!IsRecording() || !IsInGameThread())
+	{
+		return;
+	}
+
+	uint32 NodeId = 0;
+	if (TryGetNodeId(Object, NodeId))
+	{
+		uint8 RecordType = static_cast<uint8>(MDFastBindingRecorder_Private::ERecordType::Dirty);
+		*Writer << RecordType;
+		Writer->SerializeIntPacked(NodeId);
+	}
+}
+
+void FMDFastBindingRecorder::GatherNodes(const UMDFastBindingInstance& Binding, TArray<UMDFastBindingObject*>& OutNodes)
+{
+	MDFastBindingRecorder_Private::GatherNodes_Recursive(Binding.GetBindingDestination(), OutNodes);
+}
+
+bool FMDFastBindingRecorder::IsSourceNode(const UMDFastBindingValueBase& Value)
+{
+	return !Value.GetBindingItems().ContainsByPredicate([](const FMDFastBindingItem& Item)
+	{
+		return Item.Value != nullptr;
+	});
+}
+
+bool FMDFastBindingRecorder::TryGetNodeId(const UMDFastBindingObject& Object, uint32& OutNodeId)
+{
+	using namespace MDFastBindingRecorder_Private;
+
+	if (const uint32* NodeId = RecordedNodeIds.Find(&Object))
+	{
+		OutNodeId = *NodeId;
+		return OutNodeId != 0;
+	}
+
+	// Cache misses as 0 so nodes we can't identify are only looked up once
+	uint32& NodeId = RecordedNodeIds.Add(&Object, 0);
+
+	const UMDFastBindingInstance* Binding = Object.GetOuterBinding();
+	const UMDFastBindingContainer* Container = Binding != nullptr ? Binding->GetBindingContainer() : nullptr;
+	const UMDFastBindingContainer* SourceContainer = Container != nullptr ? Container->SourceContainer.Get() : nullptr;
+	const UClass* OwnerClass = Container != nullptr ? Container->GetBindingOwnerClass() : nullptr;
+	if (SourceContainer == nullptr || OwnerClass == nullptr)
+	{
+		return false;
+	}
+
+	TArray<UMDFastBindingObject*> Nodes;
+	GatherNodes(*Binding, Nodes);
+
+	FNodeKey Key;
+	Key.OwnerClassPath = OwnerClass->GetPathName();
+	Key.ContainerPath = SourceContainer->GetPathName();
+	Key.BindingIndex = Container->GetBindings().IndexOfByKey(Binding);
+	Key.NodeIndex = Nodes.IndexOfByKey(&Object);
+	if (Key.BindingIndex == INDEX_NONE || Key.NodeIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	uint32& InstanceId = RecordedInstanceIds.FindOrAdd(Container, 0);
+	if (InstanceId == 0)
+	{
+		InstanceId = RecordedInstanceIds.Num();
+	}
+	Key.InstanceId = InstanceId;
+
+	NodeId = RecordedNodeIds.Num();
+	OutNodeId = NodeId;
+
+	uint8 RecordType = static_cast<uint8>(ERecordType::Node);
+	*Writer << RecordType;
+	Writer->SerializeIntPacked(NodeId);
+	Serialize(*Writer, Key);
+
+	return true;
+}
+
+void FMDFastBindingRecorder::WriteValue(uint32 NodeId, const FProperty* Property, const void* ValuePtr)
+{
+	FString ValueText;
+	Property->ExportTextItem_Direct(ValueText, ValuePtr, nullptr, nullptr, PPF_None);
+
+	uint8 RecordType = static_cast<uint8>(MDFastBindingRecorder_Private::ERecordType::Value);
+	*Writer << RecordType;
+	Writer->SerializeIntPacked(NodeId);
+	*Writer << ValueText;
+}
+
+void FMDFastBindingRecorder::OnEndFrame()
+{
+	if (Writer != nullptr)
+	{
+		uint8 RecordType = static_cast<uint8>(MDFastBindingRecorder_Private::ERecordType::Frame);
+		*Writer << RecordType;
+	}
+}
+
+namespace MDFastBindingReplay_Private
+{
+	struct FReplayValue
+	{
+		const FProperty* Property = nullptr;
+		void* Memory = nullptr;
+	};
+
+	struct FReplayContainer
+	{
+		TStrongObjectPtr<UObject> StandInOwner;
+		TStrongObjectPtr<UMDFastBindingContainer> Container;
+	};
+
+	struct FReplayEvent
+	{
+		uint32 NodeId = 0;
+		bool bIsValue = false;
+		FString ValueText;
+	};
+
+	// Only valid while a replay is running
+	TMap<TObjectKey<UMDFastBindingValueBase>, FReplayValue>* ActiveValues = nullptr;
+
+	bool ReadRecording(const FString& FilePath, TMap<uint32, MDFastBindingRecorder_Private::FNodeKey>& OutNodes, TArray<TArray<FReplayEvent>>& OutFrames)
+	{
+		using namespace MDFastBindingRecorder_Private;
+
+		const TUniquePtr<FArchive> Reader = TUniquePtr<FArchive>(IFileManager::Get().CreateFileReader(*FilePath));
+		if (!Reader.IsValid())
+		{
+			UE_LOG(LogMDFastBinding, Error, TEXT("Failed to open binding recording [%s]"), *FilePath);
+			return false;
+		}
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		*Reader << Magic;
+		*Reader << Version;
+		if (Magic != FileMagic || Version != FileVersion)
+		{
+			UE_LOG(LogMDFastBinding, Error, TEXT("[%s] is not a supported binding recording"), *FilePath);
+			return false;
+		}
+
+		OutFrames.AddDefaulted();
+		while (!Reader->AtEnd() && !Reader->IsError())
+		{
+			uint8 RecordType = 0;
+			*Reader << RecordType;
+			switch (static_cast<ERecordType>(RecordType))
+			{
+			case ERecordType::Node:
+				{
+					uint32 NodeId = 0;
+					Reader->SerializeIntPacked(NodeId);
+					Serialize(*Reader, OutNodes.Add(NodeId));
+					break;
+				}
+			case ERecordType::Value:
+				{
+					FReplayEvent& Event = OutFrames.Last().AddDefaulted_GetRef();
+					Event.bIsValue = true;
+					Reader->SerializeIntPacked(Event.NodeId);
+					*Reader << Event.ValueText;
+					break;
+				}
+			case ERecordType::Dirty:
+				{
+					FReplayEvent& Event = OutFrames.Last().AddDefaulted_GetRef();
+					Reader->SerializeIntPacked(Event.NodeId);
+					break;
+				}
+			case ERecordType::Frame:
+				OutFrames.AddDefaulted();
+				break;
+			default:
+				UE_LOG(LogMDFastBinding, Error, TEXT("Binding recording [%s] is corrupt"), *FilePath);
+				return false;
+			}
+		}
+
+		return !Reader->IsError();
+	}
+
+	void ApplyEvents(TConstArrayView<FReplayEvent> Events, const TMap<uint32, UMDFastBindingObject*>& ReplayNodes, TMap<TObjectKey<UMDFastBindingValueBase>, FReplayValue>& Values)
+	{
+		for (const FReplayEvent& Event : Events)
+		{
+			UMDFastBindingObject* Node = ReplayNodes.FindRef(Event.NodeId);
+			if (Node == nullptr)
+			{
+				continue;
+			}
+
+			if (Event.bIsValue)
+			{
+				UMDFastBindingValueBase* Value = Cast<UMDFastBindingValueBase>(Node);
+				const FProperty* Property = Value != nullptr ? Value->GetOutputProperty() : nullptr;
+				if (Property == nullptr)
+				{
+					continue;
+				}
+
+				FReplayValue& ReplayValue = Values.FindOrAdd(Value);
+				if (ReplayValue.Memory == nullptr)
+				{
+					ReplayValue.Property = Property;
+					ReplayValue.Memory = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+					Property->InitializeValue(ReplayValue.Memory);
+				}
+
+				// Object references only resolve if the object is loaded
+				ReplayValue.Property->ImportText_Direct(*Event.ValueText, ReplayValue.Memory, nullptr, PPF_None);
+			}
+			else if (Node->GetUpdateType() == EMDFastBindingUpdateType::EventBased)
+			{
+				Node->MarkObjectDirty();
+			}
+		}
+	}
+}
+
+bool FMDFastBindingReplay::Run(const FString& FilePath, int32 NumIterations, FResult& OutResult)
+{
+	using namespace MDFastBindingReplay_Private;
+
+	if (!IsInGameThread() || IsReplaying())
+	{
+		return false;
+	}
+
+	TMap<uint32, MDFastBindingRecorder_Private::FNodeKey> RecordedNodes;
+	TArray<TArray<FReplayEvent>> Frames;
+	if (!ReadRecording(FilePath, RecordedNodes, Frames))
+	{
+		return false;
+	}
+
+	OutResult = FResult();
+	OutResult.NumFrames = Frames.Num() - 1;
+	OutResult.NumIterations = FMath::Max(1, NumIterations);
+
+	uint64 TotalUpdateCycles = 0;
+	uint64 MaxFrameCycles = 0;
+	uint64 InitializeCycles = 0;
+
+	for (int32 Iteration = 0; Iteration < OutResult.NumIterations; ++Iteration)
+	{
+		// Each recorded container instance gets its own stand-in owner and a fresh duplicate of its class level container
+		TMap<TPair<FString, uint32>, FReplayContainer> Containers;
+		TMap<uint32, UMDFastBindingObject*> ReplayNodes;
+		for (const TPair<uint32, MDFastBindingRecorder_Private::FNodeKey>& Pair : RecordedNodes)
+		{
+			const MDFastBindingRecorder_Private::FNodeKey& Key = Pair.Value;
+			FReplayContainer& ReplayContainer = Containers.FindOrAdd({ Key.ContainerPath, Key.InstanceId });
+			if (!ReplayContainer.Container.IsValid())
+			{
+				UClass* OwnerClass = LoadObject<UClass>(nullptr, *Key.OwnerClassPath);
+				const UMDFastBindingContainer* SourceContainer = LoadObject<UMDFastBindingContainer>(nullptr, *Key.ContainerPath);
+				if (OwnerClass == nullptr || OwnerClass->HasAnyClassFlags(CLASS_Abstract) || SourceContainer == nullptr)
+				{
+					UE_LOG(LogMDFastBinding, Warning, TEXT("Skipping recorded container [%s], its owner class or container could not be loaded"), *Key.ContainerPath);
+					continue;
+				}
+
+				ReplayContainer.StandInOwner.Reset(NewObject<UObject>(GetTransientPackage(), OwnerClass));
+				ReplayContainer.Container.Reset(DuplicateObject(SourceContainer, ReplayContainer.StandInOwner.Get()));
+			}
+
+			UMDFastBindingContainer* Container = ReplayContainer.Container.Get();
+			if (Container == nullptr || !Container->GetBindings().IsValidIndex(Key.BindingIndex) || Container->GetBindings()[Key.BindingIndex] == nullptr)
+			{
+				continue;
+			}
+
+			TArray<UMDFastBindingObject*> Nodes;
+			FMDFastBindingRecorder::GatherNodes(*Container->GetBindings()[Key.BindingIndex], Nodes);
+			if (Nodes.IsValidIndex(Key.NodeIndex))
+			{
+				ReplayNodes.Add(Pair.Key, Nodes[Key.NodeIndex]);
+			}
+		}
+
+		TMap<TObjectKey<UMDFastBindingValueBase>, FReplayValue> Values;
+		ActiveValues = &Values;
+
+		ApplyEvents(Frames[0], ReplayNodes, Values);
+
+		const uint64 InitializeStart = FPlatformTime::Cycles64();
+		for (const TPair<TPair<FString, uint32>, FReplayContainer>& Pair : Containers)
+		{
+			if (Pair.Value.Container.IsValid())
+			{
+				Pair.Value.Container->InitializeBindings(Pair.Value.StandInOwner.Get());
+			}
+		}
+		InitializeCycles += FPlatformTime::Cycles64() - InitializeStart;
+
+		for (int32 FrameIndex = 1; FrameIndex < Frames.Num(); ++FrameIndex)
+		{
+			ApplyEvents(Frames[FrameIndex], ReplayNodes, Values);
+
+			const uint64 FrameStart = FPlatformTime::Cycles64();
+			for (const TPair<TPair<FString, uint32>, FReplayContainer>& Pair : Containers)
+			{
+				if (Pair.Value.Container.IsValid())
+				{
+					Pair.Value.Container->UpdateBindings(Pair.Value.StandInOwner.Get());
+				}
+			}
+
+			const uint64 FrameCycles = FPlatformTime::Cycles64() - FrameStart;
+			TotalUpdateCycles += FrameCycles;
+			MaxFrameCycles = FMath::Max(MaxFrameCycles, FrameCycles);
+		}
+
+		for (const TPair<TPair<FString, uint32>, FReplayContainer>& Pair : Containers)
+		{
+			if (Pair.Value.Container.IsValid())
+			{
+				Pair.Value.Container->TerminateBindings(Pair.Value.StandInOwner.Get());
+				++OutResult.NumContainers;
+			}
+		}
+
+		ActiveValues = nullptr;
+
+		for (const TPair<TObjectKey<UMDFastBindingValueBase>, FReplayValue>& Pair : Values)
+		{
+			Pair.Value.Property->DestroyValue(Pair.Value.Memory);
+			FMemory::Free(Pair.Value.Memory);
+		}
+	}
+
+	OutResult.NumContainers /= OutResult.NumIterations;
+	OutResult.InitializeMicroseconds = FPlatformTime::ToMilliseconds64(InitializeCycles) * 1000.0 / OutResult.NumIterations;
+	OutResult.MaxMicrosecondsPerFrame = FPlatformTime::ToMilliseconds64(MaxFrameCycles) * 1000.0;
+	if (OutResult.NumFrames > 0)
+	{
+		OutResult.AverageMicrosecondsPerFrame = FPlatformTime::ToMilliseconds64(TotalUpdateCycles) * 1000.0 / (OutResult.NumFrames * OutResult.NumIterations);
+	}
+
+	return true;
+}
+
+bool FMDFastBindingReplay::IsReplaying()
+{
+	return MDFastBindingReplay_Private::ActiveValues != nullptr;
+}
+
+bool FMDFastBindingReplay::FindValueOverride(const UMDFastBindingValueBase& Value, TTuple<const FProperty*, void*>& OutValue)
+{
+	if (MDFastBindingReplay_Private::ActiveValues == nullptr)
+	{
+		return false;
+	}
+
+	if (const MDFastBindingReplay_Private::FReplayValue* ReplayValue = MDFastBindingReplay_Private::ActiveValues->Find(&Value))
+	{
+		OutValue = { ReplayValue->Property, ReplayValue->Memory };
+		return true;
+	}
+
+	return false;
+}
+#endif
@@ -0,0 +1,9 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingStats.h"
+
+LLM_DEFINE_TAG(MDFastBinding);
+
+DEFINE_STAT(STAT_MDFastBinding_WidgetWrites);
+DEFINE_STAT(STAT_MDFastBinding_BatchedWidgetWrites);
+DEFINE_STAT(STAT_MDFastBinding_WidgetInvalidations);
@@ -0,0 +1,21 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingTrace.h"
+
+#if CPUPROFILERTRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(MDFastBindingChannel);
+
+uint32 FMDFastBindingTrace::GetEventType(const FString& Name)
+{
+	static FCriticalSection EventTypesLock;
+	static TMap<FString, uint32> EventTypes;
+
+	FScopeLock Lock(&EventTypesLock);
+	if (const uint32* EventType = EventTypes.Find(Name))
+	{
+		return *EventType;
+	}
+
+	return EventTypes.Add(Name, FCpuProfilerTrace::OutputEventType(*Name));
+}
+#endif
@@ -0,0 +1,152 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDFastBindingWidgetUpdateBatch.h"
+
+#include "Components/Widget.h"
+#include "HAL/IConsoleManager.h"
+#if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
+#include "INotifyFieldValueChanged.h"
+#else
+#include "FieldNotification/IFieldValueChanged.h"
+#endif
+#include "MDFastBinding.h"
+#include "MDFastBindingStats.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+namespace MDFastBindingWidgetUpdateBatch_Private
+{
+	bool bBatchWidgetUpdates = true;
+	FAutoConsoleVariableRef CVarBatchWidgetUpdates(
+		TEXT("MDFastBinding.BatchWidgetUpdates"),
+		bBatchWidgetUpdates,
+		TEXT("If true, binding writes to UMG widget properties with setters are deferred until the end of the binding update pass so each property's setter is called once per pass with the last value written."),
+		ECVF_Default);
+
+	const FName UMGPackageName = TEXT("/Script/UMG");
+
+	struct FPendingWrite
+	{
+		TWeakObjectPtr<UWidget> Widget;
+		const FProperty* Property = nullptr;
+		// Holds the last value written, already converted to the property's type
+		void* Value = nullptr;
+		UE::FieldNotification::FFieldId FieldId;
+	};
+
+	int32 BatchDepth = 0;
+	TArray<FPendingWrite> PendingWrites;
+	TMap<TPair<TWeakObjectPtr<UWidget>, const FProperty*>, int32> PendingWriteIndices;
+
+	// Engine widget setters only store the value and invalidate, setters declared on other widget classes may depend on being called in order
+	bool IsEngineWidgetProperty(const FProperty* Property)
+	{
+		const UClass* OwnerClass = Property->GetOwnerClass();
+		return OwnerClass != nullptr && OwnerClass->GetPackage()->GetFName() == UMGPackageName;
+	}
+}
+
+bool FMDFastBindingWidgetUpdateBatch::IsBatching()
+{
+	return MDFastBindingWidgetUpdateBatch_Private::BatchDepth > 0 && MDFastBindingWidgetUpdateBatch_Private::bBatchWidgetUpdates;
+}
+
+bool FMDFastBindingWidgetUpdateBatch::TrySetWidgetProperty(UObject* PropertyOwner, const FProperty* DestinationProp, const FProperty* SourceProp, const void* SourceValuePtr, const UE::FieldNotification::FFieldId& FieldId)
+{
+	using namespace MDFastBindingWidgetUpdateBatch_Private;
+
+	UWidget* Widget = Cast<UWidget>(PropertyOwner);
+	if (Widget == nullptr || DestinationProp == nullptr || DestinationProp->GetOwner<UClass>() == nullptr)
+	{
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_MDFastBinding_WidgetWrites);
+
+	// Without a setter the value is written in place, which doesn't invalidate anything
+	if (!DestinationProp->HasSetter())
+	{
+		return false;
+	}
+
+	if (!IsBatching() || !IsInGameThread() || !IsEngineWidgetProperty(DestinationProp) || DestinationProp->ArrayDim != 1)
+	{
+		INC_DWORD_STAT(STAT_MDFastBinding_WidgetInvalidations);
+		return false;
+	}
+
+	int32& WriteIndex = PendingWriteIndices.FindOrAdd(MakeTuple(TWeakObjectPtr<UWidget>(Widget), DestinationProp), INDEX_NONE);
+	if (WriteIndex == INDEX_NONE)
+	{
+		WriteIndex = PendingWrites.Num();
+		FPendingWrite& NewWrite = PendingWrites.AddDefaulted_GetRef();
+		NewWrite.Widget = Widget;
+		NewWrite.Property = DestinationProp;
+		NewWrite.Value = FMemory::Malloc(DestinationProp->GetSize(), DestinationProp->GetMinAlignment());
+		DestinationProp->InitializeValue(NewWrite.Value);
+	}
+
+	// Last write wins, an earlier write's field notification is still sent since listeners may have been told about the old value
+	FPendingWrite& Write = PendingWrites[WriteIndex];
+	FMDFastBindingModule::SetPropertyDirectly(DestinationProp, Write.Value, SourceProp, SourceValuePtr);
+	if (FieldId.IsValid())
+	{
+		Write.FieldId = FieldId;
+	}
+
+	INC_DWORD_STAT(STAT_MDFastBinding_BatchedWidgetWrites);
+
+	return true;
+}
+
+void FMDFastBindingWidgetUpdateBatch::OpenBatch()
+{
+	if (IsInGameThread())
+	{
+		++MDFastBindingWidgetUpdateBatch_Private::BatchDepth;
+	}
+}
+
+void FMDFastBindingWidgetUpdateBatch::CloseBatch()
+{
+	using namespace MDFastBindingWidgetUpdateBatch_Private;
+
+	if (!IsInGameThread() || --BatchDepth > 0)
+	{
+		return;
+	}
+
+	if (PendingWrites.IsEmpty())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Setters can trigger other bindings to update, so flush from a local copy
+	TArray<FPendingWrite> Writes = MoveTemp(PendingWrites);
+	PendingWrites.Reset();
+	PendingWriteIndices.Reset();
+
+	for (const FPendingWrite& Write : Writes)
+	{
+		if (UWidget* Widget = Write.Widget.Get())
+		{
+			Write.Property->SetValue_InContainer(Widget, Write.Value);
+			INC_DWORD_STAT(STAT_MDFastBinding_WidgetInvalidations);
+
+#if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
+			if (Write.FieldId.IsValid())
+			{
+				if (INotifyFieldValueChanged* FieldNotify = Cast<INotifyFieldValueChanged>(Widget))
+				{
+					FieldNotify->BroadcastFieldValueChanged(Write.FieldId);
+				}
+			}
+#endif
+		}
+
+		Write.Property->DestroyValue(Write.Value);
+		FMemory::Free(Write.Value);
+	}
+}
@@ -0,0 +1,237 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "PropertySetters/MDFastBindingBulkConversion.h"
+
+#include "Math/VectorRegister.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+namespace MDFastBindingBulkConversion_Private
+{
+	enum class EBulkType : uint8
+	{
+		None,
+		Float,
+		Double,
+		Int32,
+		Int64,
+		UInt8,
+		Color,
+		LinearColor
+	};
+
+	EBulkType GetBulkType(const FProperty& Prop)
+	{
+		if (Prop.ArrayDim != 1)
+		{
+			return EBulkType::None;
+		}
+
+		if (Prop.IsA<FFloatProperty>())
+		{
+			return EBulkType::Float;
+		}
+		else if (Prop.IsA<FDoubleProperty>())
+		{
+			return EBulkType::Double;
+		}
+		else if (Prop.IsA<FIntProperty>())
+		{
+			return EBulkType::Int32;
+		}
+		else if (Prop.IsA<FInt64Property>())
+		{
+			return EBulkType::Int64;
+		}
+		else if (const FByteProperty* ByteProp = CastField<const FByteProperty>(&Prop))
+		{
+			// Enums have their own rules for invalid values
+			return ByteProp->Enum == nullptr ? EBulkType::UInt8 : EBulkType::None;
+		}
+		else if (const FStructProperty* StructProp = CastField<const FStructProperty>(&Prop))
+		{
+			if (StructProp->Struct == TBaseStructure<FColor>::Get())
+			{
+				return EBulkType::Color;
+			}
+			else if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
+			{
+				return EBulkType::LinearColor;
+			}
+		}
+
+		return EBulkType::None;
+	}
+
+	bool IsNumeric(EBulkType Type)
+	{
+		return Type != EBulkType::None && Type != EBulkType::Color && Type != EBulkType::LinearColor;
+	}
+
+	bool IsFloatingPoint(EBulkType Type)
+	{
+		return Type == EBulkType::Float || Type == EBulkType::Double;
+	}
+
+	bool CanConvert(EBulkType DestType, EBulkType SourceType)
+	{
+		if (DestType == EBulkType::None || SourceType == EBulkType::None || DestType == SourceType)
+		{
+			return false;
+		}
+
+		if (IsNumeric(DestType) && IsNumeric(SourceType))
+		{
+			return true;
+		}
+
+		return (DestType == EBulkType::Color && SourceType == EBulkType::LinearColor)
+			|| (DestType == EBulkType::LinearColor && SourceType == EBulkType::Color);
+	}
+
+	// Plain loops over contiguous memory, the casts can be vectorized by the compiler
+	template<typename DestType, typename SourceType>
+	void ConvertNumeric(DestType* RESTRICT Dest, const SourceType* RESTRICT Source, int32 Num)
+	{
+		if constexpr (std::is_integral_v<DestType> && std::is_floating_point_v<SourceType>)
+		{
+			// Saturates like the numeric property setter, this branches per element so it's only a tighter loop than going through the setter
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Dest[i] = FMDFastBindingBulkConversion::SaturateToInteger<DestType>(Source[i]);
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Dest[i] = static_cast<DestType>(Source[i]);
+			}
+		}
+	}
+
+	template<typename SourceType>
+	void ConvertNumericFrom(EBulkType DestType, void* Dest, const SourceType* Source, int32 Num)
+	{
+		switch (DestType)
+		{
+		case EBulkType::Float:
+			ConvertNumeric(static_cast<float*>(Dest), Source, Num);
+			break;
+		case EBulkType::Double:
+			ConvertNumeric(static_cast<double*>(Dest), Source, Num);
+			break;
+		case EBulkType::Int32:
+			ConvertNumeric(static_cast<int32*>(Dest), Source, Num);
+			break;
+		case EBulkType::Int64:
+			ConvertNumeric(static_cast<int64*>(Dest), Source, Num);
+			break;
+		case EBulkType::UInt8:
+			ConvertNumeric(static_cast<uint8*>(Dest), Source, Num);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+bool FMDFastBindingBulkConversion::CanConvert(const FProperty& DestinationElementProp, const FProperty& SourceElementProp)
+{
+	using namespace MDFastBindingBulkConversion_Private;
+
+	return MDFastBindingBulkConversion_Private::CanConvert(GetBulkType(DestinationElementProp), GetBulkType(SourceElementProp));
+}
+
+bool FMDFastBindingBulkConversion::Convert(const FProperty& DestinationElementProp, void* DestinationElements, const FProperty& SourceElementProp, const void* SourceElements, int32 Num)
+{
+	using namespace MDFastBindingBulkConversion_Private;
+
+	const EBulkType DestType = GetBulkType(DestinationElementProp);
+	const EBulkType SourceType = GetBulkType(SourceElementProp);
+	if (!MDFastBindingBulkConversion_Private::CanConvert(DestType, SourceType))
+	{
+		return false;
+	}
+
+	if (Num <= 0)
+	{
+		return true;
+	}
+
+	switch (SourceType)
+	{
+	case EBulkType::Float:
+		ConvertNumericFrom(DestType, DestinationElements, static_cast<const float*>(SourceElements), Num);
+		break;
+	case EBulkType::Double:
+		ConvertNumericFrom(DestType, DestinationElements, static_cast<const double*>(SourceElements), Num);
+		break;
+	case EBulkType::Int32:
+		ConvertNumericFrom(DestType, DestinationElements, static_cast<const int32*>(SourceElements), Num);
+		break;
+	case EBulkType::Int64:
+		ConvertNumericFrom(DestType, DestinationElements, static_cast<const int64*>(SourceElements), Num);
+		break;
+	case EBulkType::UInt8:
+		ConvertNumericFrom(DestType, DestinationElements, static_cast<const uint8*>(SourceElements), Num);
+		break;
+	case EBulkType::LinearColor:
+		ConvertLinearColorsToColors(static_cast<FColor*>(DestinationElements), static_cast<const FLinearColor*>(SourceElements), Num);
+		break;
+	case EBulkType::Color:
+		ConvertColorsToLinearColors(static_cast<FLinearColor*>(DestinationElements), static_cast<const FColor*>(SourceElements), Num);
+		break;
+	default:
+		return false;
+	}
+
+	return true;
+}
+
+void FMDFastBindingBulkConversion::ConvertLinearColorsToColors(FColor* DestinationColors, const FLinearColor* SourceColors, int32 Num)
+{
+#if PLATFORM_LITTLE_ENDIAN
+	// Each register holds one color's channels. FColor is stored as BGRA, so swizzle before packing each lane down to a byte
+	const VectorRegister4Float Scale = VectorSetFloat1(255.999f);
+	auto ClampAndScale = [&Scale](const FLinearColor& Color)
+	{
+		const VectorRegister4Float Clamped = VectorMin(VectorMax(VectorLoad(&Color.R), GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatOne);
+		return VectorSwizzle(VectorMultiply(Clamped, Scale), 2, 1, 0, 3);
+	};
+
+	// Four colors per iteration so their clamps and scales don't wait on each other
+	int32 i = 0;
+	for (; i + 4 <= Num; i += 4)
+	{
+		const VectorRegister4Float Color0 = ClampAndScale(SourceColors[i]);
+		const VectorRegister4Float Color1 = ClampAndScale(SourceColors[i + 1]);
+		const VectorRegister4Float Color2 = ClampAndScale(SourceColors[i + 2]);
+		const VectorRegister4Float Color3 = ClampAndScale(SourceColors[i + 3]);
+		VectorStoreByte4(Color0, &DestinationColors[i]);
+		VectorStoreByte4(Color1, &DestinationColors[i + 1]);
+		VectorStoreByte4(Color2, &DestinationColors[i + 2]);
+		VectorStoreByte4(Color3, &DestinationColors[i + 3]);
+	}
+
+	for (; i < Num; ++i)
+	{
+		VectorStoreByte4(ClampAndScale(SourceColors[i]), &DestinationColors[i]);
+	}
+#else
+	for (int32 i = 0; i < Num; ++i)
+	{
+		constexpr bool bSRGB = false;
+		DestinationColors[i] = SourceColors[i].ToFColor(bSRGB);
+	}
+#endif
+}
+
+void FMDFastBindingBulkConversion::ConvertColorsToLinearColors(FLinearColor* DestinationColors, const FColor* SourceColors, int32 Num)
+{
+	// The FColor constructor is a lookup into the sRGB table per channel
+	for (int32 i = 0; i < Num; ++i)
+	{
+		DestinationColors[i] = FLinearColor(SourceColors[i]);
+	}
+}
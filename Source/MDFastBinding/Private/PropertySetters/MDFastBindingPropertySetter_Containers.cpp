@@ -3,10 +3,38 @@
 #include "PropertySetters/MDFastBindingPropertySetter_Containers.h"
 
 #include "MDFastBinding.h"
+#include "PropertySetters/MDFastBindingBulkConversion.h"
 #include "UObject/UnrealType.h"
 
 namespace MDFastBindingPropertySetter_Containers_Private
 {
+	// Resolves the setter for a pair of element properties once per container instead of once per element
+	struct FElementSetter
+	{
+		FElementSetter(const FProperty* InDestinationProp, const FProperty* InSourceProp)
+			: DestinationProp(InDestinationProp)
+			, SourceProp(InSourceProp)
+			, Setter(FMDFastBindingModule::FindPropertySetter(InDestinationProp, InSourceProp))
+		{
+		}
+
+		void SetValue(void* DestinationValuePtr, const void* SourceValuePtr) const
+		{
+			if (Setter != nullptr)
+			{
+				Setter->SetPropertyDirectly(*DestinationProp, DestinationValuePtr, *SourceProp, SourceValuePtr);
+			}
+			else
+			{
+				FMDFastBindingModule::SetPropertyDirectly(DestinationProp, DestinationValuePtr, SourceProp, SourceValuePtr);
+			}
+		}
+
+		const FProperty* DestinationProp = nullptr;
+		const FProperty* SourceProp = nullptr;
+		const IMDFastBindingPropertySetter* Setter = nullptr;
+	};
+
 	template<bool bIsDestinationAContainer>
 	void SetPropertyImpl(const FProperty& DestinationProp, void* DestinationPtr, const FProperty& SourceProp, const void* SourceValuePtr)
 	{
@@ -21,6 +49,10 @@ namespace MDFastBindingPropertySetter_Containers_Private
 
 		const FArrayProperty* DestArrayProp = CastField<const FArrayProperty>(&DestinationProp);
 		const FArrayProperty* SrcArrayProp = CastField<const FArrayProperty>(&SourceProp);
+		const FSetProperty* DestSetProp = CastField<const FSetProperty>(&DestinationProp);
+		const FSetProperty* SrcSetProp = CastField<const FSetProperty>(&SourceProp);
+		const FMapProperty* DestMapProp = CastField<const FMapProperty>(&DestinationProp);
+		const FMapProperty* SrcMapProp = CastField<const FMapProperty>(&SourceProp);
 		if (DestArrayProp != nullptr && SrcArrayProp != nullptr)
 		{
 			FScriptArrayHelper DestHelper = FScriptArrayHelper(DestArrayProp, DestinationPtr);
@@ -37,19 +69,17 @@ namespace MDFastBindingPropertySetter_Containers_Private
 				DestHelper.RemoveValues(0, NumDestElements - NumSrcElements);
 			}
 
-			for (int32 i = 0; i < NumSrcElements; ++i)
+			// Array elements are contiguous, so numeric and color arrays can be converted in one pass
+			if (NumSrcElements > 0 && !FMDFastBindingBulkConversion::Convert(*DestArrayProp->Inner, DestHelper.GetRawPtr(0), *SrcArrayProp->Inner, SrcHelper.GetRawPtr(0), NumSrcElements))
 			{
-				const void* SrcValuePtr = SrcHelper.GetRawPtr(i);
-				void* DestValuePtr = DestHelper.GetRawPtr(i);
-				FMDFastBindingModule::SetPropertyDirectly(DestArrayProp->Inner, DestValuePtr, SrcArrayProp->Inner, SrcValuePtr);
+				const FElementSetter ElementSetter = FElementSetter(DestArrayProp->Inner, SrcArrayProp->Inner);
+				for (int32 i = 0; i < NumSrcElements; ++i)
+				{
+					ElementSetter.SetValue(DestHelper.GetRawPtr(i), SrcHelper.GetRawPtr(i));
+				}
 			}
-
-			return;
 		}
-
-		const FSetProperty* DestSetProp = CastField<const FSetProperty>(&DestinationProp);
-		const FSetProperty* SrcSetProp = CastField<const FSetProperty>(&SourceProp);
-		if (DestSetProp != nullptr && SrcSetProp != nullptr)
+		else if (DestSetProp != nullptr && SrcSetProp != nullptr)
 		{
 			FScriptSetHelper DestHelper = FScriptSetHelper(DestSetProp, DestinationPtr);
 			FScriptSetHelper SrcHelper = FScriptSetHelper(SrcSetProp, SourceValuePtr);
@@ -57,21 +87,16 @@ namespace MDFastBindingPropertySetter_Containers_Private
 			const int32 NumSrcElements = SrcHelper.Num();
 			DestHelper.EmptyElements(NumSrcElements);
 
+			const FElementSetter ElementSetter = FElementSetter(DestSetProp->ElementProp, SrcSetProp->ElementProp);
 			for (int32 i = 0; i < NumSrcElements; ++i)
 			{
 				DestHelper.AddDefaultValue_Invalid_NeedsRehash();
-				const void* SrcValuePtr = SrcHelper.GetElementPtr(i);
-				void* DestValuePtr = DestHelper.GetElementPtr(i);
-				FMDFastBindingModule::SetPropertyDirectly(DestSetProp->ElementProp, DestValuePtr, SrcSetProp->ElementProp, SrcValuePtr);
+				ElementSetter.SetValue(DestHelper.GetElementPtr(i), SrcHelper.GetElementPtr(i));
 			}
 
 			DestHelper.Rehash();
-			return;
 		}
-
-		const FMapProperty* DestMapProp = CastField<const FMapProperty>(&DestinationProp);
-		const FMapProperty* SrcMapProp = CastField<const FMapProperty>(&SourceProp);
-		if (DestMapProp != nullptr && SrcMapProp != nullptr)
+		else if (DestMapProp != nullptr && SrcMapProp != nullptr)
 		{
 			FScriptMapHelper DestHelper = FScriptMapHelper(DestMapProp, DestinationPtr);
 			FScriptMapHelper SrcHelper = FScriptMapHelper(SrcMapProp, SourceValuePtr);
@@ -79,17 +104,13 @@ namespace MDFastBindingPropertySetter_Containers_Private
 			const int32 NumSrcElements = SrcHelper.Num();
 			DestHelper.EmptyValues(NumSrcElements);
 
+			const FElementSetter KeySetter = FElementSetter(DestMapProp->KeyProp, SrcMapProp->KeyProp);
+			const FElementSetter ValueSetter = FElementSetter(DestMapProp->ValueProp, SrcMapProp->ValueProp);
 			for (int32 i = 0; i < NumSrcElements; ++i)
 			{
 				DestHelper.AddDefaultValue_Invalid_NeedsRehash();
-
-				const void* SrcKeyPtr = SrcHelper.GetKeyPtr(i);
-				void* DestKeyPtr = DestHelper.GetKeyPtr(i);
-				FMDFastBindingModule::SetPropertyDirectly(DestSetProp->ElementProp, DestKeyPtr, SrcSetProp->ElementProp, SrcKeyPtr);
-
-				const void* SrcValuePtr = SrcHelper.GetValuePtr(i);
-				void* DestValuePtr = DestHelper.GetValuePtr(i);
-				FMDFastBindingModule::SetPropertyDirectly(DestSetProp->ElementProp, DestValuePtr, SrcSetProp->ElementProp, SrcValuePtr);
+				KeySetter.SetValue(DestHelper.GetKeyPtr(i), SrcHelper.GetKeyPtr(i));
+				ValueSetter.SetValue(DestHelper.GetValuePtr(i), SrcHelper.GetValuePtr(i));
 			}
 
 			DestHelper.Rehash();
@@ -99,6 +120,7 @@ namespace MDFastBindingPropertySetter_Containers_Private
 		{
 			DestinationProp.SetValue_InContainer(DestinationContainerPtr, DestinationPtr);
 
+			DestinationProp.DestroyValue(DestinationPtr);
 			FMemory::Free(DestinationPtr);
 			DestinationPtr = nullptr;
 		}
@@ -1,8 +1,42 @@
 ﻿// Copyright Dylan Dumesnil. All Rights Reserved.
 
 #include "PropertySetters/MDFastBindingPropertySetter_Numeric.h"
+#include "PropertySetters/MDFastBindingBulkConversion.h"
 #include "UObject/UnrealType.h"
 
+namespace MDFastBindingPropertySetter_Numeric_Private
+{
+	// Negative signed values read back as huge unsigned values, which floating point properties can still hold
+	bool IsSignedInteger(const FNumericProperty& Prop)
+	{
+		return Prop.IsA<FInt8Property>() || Prop.IsA<FInt16Property>() || Prop.IsA<FIntProperty>() || Prop.IsA<FInt64Property>();
+	}
+
+	template<typename PropertyType>
+	bool TrySetSaturatedValue(const FNumericProperty& DestProp, void* DestValuePtr, double Value)
+	{
+		if (DestProp.IsA<PropertyType>())
+		{
+			*static_cast<typename PropertyType::TCppType*>(DestValuePtr) = FMDFastBindingBulkConversion::SaturateToInteger<typename PropertyType::TCppType>(Value);
+			return true;
+		}
+
+		return false;
+	}
+
+	// Returns false if DestProp isn't an integer property
+	bool SetSaturatedIntegerValue(const FNumericProperty& DestProp, void* DestValuePtr, double Value)
+	{
+		return TrySetSaturatedValue<FInt8Property>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FInt16Property>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FIntProperty>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FInt64Property>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FByteProperty>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FUInt16Property>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FUInt32Property>(DestProp, DestValuePtr, Value)
+			|| TrySetSaturatedValue<FUInt64Property>(DestProp, DestValuePtr, Value);
+	}
+}
 
 void FMDFastBindingPropertySetter_Numeric::SetPropertyInContainer(const FProperty& DestinationProp, void* DestinationContainerPtr, const FProperty& SourceProp, const void* SourceValuePtr) const
 {
@@ -55,12 +89,16 @@ void FMDFastBindingPropertySetter_Numeric::SetPropertyInContainer(const FPropert
 		}
 		else if (DestNumericProp->IsA<FFloatProperty>())
 		{
-			const FFloatProperty::TCppType Value = UnsignedValue;
+			const FFloatProperty::TCppType Value = MDFastBindingPropertySetter_Numeric_Private::IsSignedInteger(*SourceNumericProp)
+				? static_cast<FFloatProperty::TCppType>(SourceNumericProp->GetSignedIntPropertyValue(SourceValuePtr))
+				: static_cast<FFloatProperty::TCppType>(UnsignedValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FDoubleProperty>())
 		{
-			const FDoubleProperty::TCppType Value = UnsignedValue;
+			const FDoubleProperty::TCppType Value = MDFastBindingPropertySetter_Numeric_Private::IsSignedInteger(*SourceNumericProp)
+				? static_cast<FDoubleProperty::TCppType>(SourceNumericProp->GetSignedIntPropertyValue(SourceValuePtr))
+				: static_cast<FDoubleProperty::TCppType>(UnsignedValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 	}
@@ -69,42 +107,42 @@ void FMDFastBindingPropertySetter_Numeric::SetPropertyInContainer(const FPropert
 		const double DoubleValue = SourceNumericProp->GetFloatingPointPropertyValue(SourceValuePtr);
 		if (DestNumericProp->IsA<FInt8Property>())
 		{
-			const FInt8Property::TCppType Value = DoubleValue;
+			const FInt8Property::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FInt8Property::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FInt16Property>())
 		{
-			const FInt16Property::TCppType Value = DoubleValue;
+			const FInt16Property::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FInt16Property::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FIntProperty>())
 		{
-			const FIntProperty::TCppType Value = DoubleValue;
+			const FIntProperty::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FIntProperty::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FInt64Property>())
 		{
-			const FInt64Property::TCppType Value = DoubleValue;
+			const FInt64Property::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FInt64Property::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FByteProperty>())
 		{
-			const FByteProperty::TCppType Value = DoubleValue;
+			const FByteProperty::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FByteProperty::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FUInt16Property>())
 		{
-			const FUInt16Property::TCppType Value = DoubleValue;
+			const FUInt16Property::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FUInt16Property::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FUInt32Property>())
 		{
-			const FUInt32Property::TCppType Value = DoubleValue;
+			const FUInt32Property::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FUInt32Property::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FUInt64Property>())
 		{
-			const FUInt64Property::TCppType Value = DoubleValue;
+			const FUInt64Property::TCppType Value = FMDFastBindingBulkConversion::SaturateToInteger<FUInt64Property::TCppType>(DoubleValue);
 			DestNumericProp->SetValue_InContainer(DestinationContainerPtr, &Value);
 		}
 		else if (DestNumericProp->IsA<FFloatProperty>())
@@ -141,14 +179,13 @@ void FMDFastBindingPropertySetter_Numeric::SetPropertyDirectly(const FProperty&
 		}
 		else if (DestNumericProp->IsFloatingPoint())
 		{
-			const uint64 UnsignedValue = SourceNumericProp->GetUnsignedIntPropertyValue(SourceValuePtr);
-			if (DestNumericProp->CanHoldValue(UnsignedValue))
+			if (MDFastBindingPropertySetter_Numeric_Private::IsSignedInteger(*SourceNumericProp))
 			{
-				DestNumericProp->SetFloatingPointPropertyValue(DestinationValuePtr, UnsignedValue);
+				DestNumericProp->SetFloatingPointPropertyValue(DestinationValuePtr, SourceNumericProp->GetSignedIntPropertyValue(SourceValuePtr));
 			}
 			else
 			{
-				DestNumericProp->SetFloatingPointPropertyValue(DestinationValuePtr, SourceNumericProp->GetSignedIntPropertyValue(SourceValuePtr));
+				DestNumericProp->SetFloatingPointPropertyValue(DestinationValuePtr, SourceNumericProp->GetUnsignedIntPropertyValue(SourceValuePtr));
 			}
 		}
 	}
@@ -156,16 +193,7 @@ void FMDFastBindingPropertySetter_Numeric::SetPropertyDirectly(const FProperty&
 	{
 		if (DestNumericProp->IsInteger())
 		{
-			const uint64 UnsignedValue = SourceNumericProp->GetFloatingPointPropertyValue(SourceValuePtr);
-			if (DestNumericProp->CanHoldValue(UnsignedValue))
-			{
-				DestNumericProp->SetFloatingPointPropertyValue(DestinationValuePtr, UnsignedValue);
-			}
-			else
-			{
-				const int32 SignedValue = SourceNumericProp->GetFloatingPointPropertyValue(SourceValuePtr);
-				DestNumericProp->SetFloatingPointPropertyValue(DestinationValuePtr, SignedValue);
-			}
+			MDFastBindingPropertySetter_Numeric_Private::SetSaturatedIntegerValue(*DestNumericProp, DestinationValuePtr, SourceNumericProp->GetFloatingPointPropertyValue(SourceValuePtr));
 		}
 		else if (DestNumericProp->IsFloatingPoint())
 		{
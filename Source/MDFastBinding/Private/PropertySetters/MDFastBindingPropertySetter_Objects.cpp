@@ -1,6 +1,8 @@
 ﻿// Copyright Dylan Dumesnil. All Rights Reserved.
 
 #include "PropertySetters/MDFastBindingPropertySetter_Objects.h"
+
+#include "MDFastBindingAsyncLoader.h"
 #include "UObject/Field.h"
 #include "UObject/UnrealType.h"
 
@@ -15,6 +17,26 @@ namespace MDFastBindingPropertySetter_Objects_Private
 		const FInterfaceProperty* SrcInterfaceProp = CastField<const FInterfaceProperty>(&SourceProp);
 
 		UObject* ObjectValue = (SrcObjProp != nullptr) ? SrcObjProp->GetObjectPropertyValue(SourceValuePtr) : SrcInterfaceProp->GetPropertyValue(SourceValuePtr).GetObject();
+
+		// Soft references going into hard references are streamed in, keeping the destination's current value until the load completes
+		const FSoftObjectProperty* SoftSrcObjProp = CastField<const FSoftObjectProperty>(&SourceProp);
+		if (SoftSrcObjProp != nullptr && !DestinationProp.IsA<FSoftObjectProperty>())
+		{
+			const FSoftObjectPtr& SoftObjectValue = SoftSrcObjProp->GetPropertyValue(SourceValuePtr);
+			if (ObjectValue == nullptr)
+			{
+				if (!SoftObjectValue.IsNull() && FMDFastBindingAsyncLoader::RequestLoad(SoftObjectValue.ToSoftObjectPath()))
+				{
+					return;
+				}
+			}
+			else
+			{
+				// The destination holds the object from now on, so a load we started for it no longer has to keep it loaded
+				FMDFastBindingAsyncLoader::NotifyLoadConsumed(SoftObjectValue.ToSoftObjectPath());
+			}
+		}
+
 		const UClass* SourcePropClass = (SrcObjProp != nullptr) ? SrcObjProp->PropertyClass : SrcInterfaceProp->InterfaceClass;
 		UClass* DestinationClass = (DestObjProp != nullptr) ? DestObjProp->PropertyClass : DestInterfaceProp->InterfaceClass;
 
@@ -27,7 +49,6 @@ namespace MDFastBindingPropertySetter_Objects_Private
 		{
 			// Special case for soft object ptrs since we want them to stay soft object ptrs
 			const FSoftObjectProperty* SoftDestObjProp = CastField<const FSoftObjectProperty>(&DestinationProp);
-			const FSoftObjectProperty* SoftSrcObjProp = CastField<const FSoftObjectProperty>(&SourceProp);
 			if (SoftDestObjProp != nullptr && SoftSrcObjProp != nullptr)
 			{
 				if constexpr (bIsDestinationAContainer)
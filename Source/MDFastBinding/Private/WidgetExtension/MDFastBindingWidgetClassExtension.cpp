@@ -3,6 +3,7 @@
 #include "WidgetExtension/MDFastBindingWidgetClassExtension.h"
 
 #include "Blueprint/UserWidget.h"
+#include "Engine/World.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "MDFastBindingContainer.h"
 #include "MDFastBindingHelpers.h"
@@ -18,6 +19,13 @@ void UMDFastBindingWidgetClassExtension::Initialize(UUserWidget* UserWidget)
 		return;
 	}
 
+	if (ShouldUseFlattenedBindings(*UserWidget))
+	{
+		UMDFastBindingWidgetExtension* SpawnedExtension = UserWidget->AddExtension<UMDFastBindingWidgetExtension>();
+		SpawnedExtension->SetBindingContainer(FlattenedBindingContainer);
+		return;
+	}
+
 	UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(UserWidget->GetClass());
 	if (!HasBindings() && !FMDFastBindingHelpers::DoesClassHaveSuperClassBindings(WidgetClass))
 	{
@@ -59,6 +67,33 @@ bool UMDFastBindingWidgetClassExtension::HasBindings() const
 	return BindingContainer != nullptr && BindingContainer->HasBindings();
 }
 
+bool UMDFastBindingWidgetClassExtension::ShouldUseFlattenedBindings(const UUserWidget& UserWidget)
+{
+#if WITH_EDITOR
+	// The designer and the blueprint editor's preview expect a container per class
+	const UWorld* World = UserWidget.GetWorld();
+	if (UserWidget.IsDesignTime() || World == nullptr || !World->IsGameWorld())
+	{
+		return false;
+	}
+
+	// Super classes can be recompiled without recompiling this class, rebuild if any of their containers were replaced
+	const TArray<const UMDFastBindingContainer*> ClassContainers = GatherClassBindingContainers();
+	bool bIsFlattenedContainerStale = ClassContainers.Num() != FlattenedSourceContainers.Num();
+	for (int32 i = 0; i < ClassContainers.Num() && !bIsFlattenedContainerStale; ++i)
+	{
+		bIsFlattenedContainerStale = FlattenedSourceContainers[i].Get() != ClassContainers[i];
+	}
+
+	if (bIsFlattenedContainerStale)
+	{
+		BuildFlattenedBindingContainer();
+	}
+#endif
+
+	return FlattenedBindingContainer != nullptr && FlattenedBindingContainer->HasBindings();
+}
+
 #if WITH_EDITOR
 void UMDFastBindingWidgetClassExtension::Construct(UUserWidget* UserWidget)
 {
@@ -77,4 +112,48 @@ void UMDFastBindingWidgetClassExtension::SetBindingContainer(UMDFastBindingConta
 {
 	BindingContainer = DuplicateObject(BPBindingContainer, this);
 }
+
+void UMDFastBindingWidgetClassExtension::BuildFlattenedBindingContainer()
+{
+	FlattenedBindingContainer = nullptr;
+
+	const TArray<const UMDFastBindingContainer*> ClassContainers = GatherClassBindingContainers();
+	FlattenedSourceContainers.Reset(ClassContainers.Num());
+	for (const UMDFastBindingContainer* Container : ClassContainers)
+	{
+		FlattenedSourceContainers.Add(Container);
+	}
+
+	UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(GetBindingOwnerClass());
+	if (!FMDFastBindingHelpers::DoesClassHaveSuperClassBindings(WidgetClass))
+	{
+		return;
+	}
+
+	FlattenedBindingContainer = NewObject<UMDFastBindingContainer>(this, TEXT("FlattenedBindingContainer"));
+
+	// Same order the per-class containers update in, most derived class first
+	TSet<FString> DestinationKeys;
+	for (const UMDFastBindingContainer* Container : ClassContainers)
+	{
+		FlattenedBindingContainer->AppendFlattenedBindings(Container, DestinationKeys);
+	}
+}
+
+TArray<const UMDFastBindingContainer*> UMDFastBindingWidgetClassExtension::GatherClassBindingContainers() const
+{
+	TArray<const UMDFastBindingContainer*> Containers = { BindingContainer };
+
+	const UClass* OwnerClass = GetBindingOwnerClass();
+	const UWidgetBlueprintGeneratedClass* SuperClass = Cast<UWidgetBlueprintGeneratedClass>(OwnerClass != nullptr ? OwnerClass->GetSuperClass() : nullptr);
+	while (SuperClass != nullptr)
+	{
+		const UMDFastBindingWidgetClassExtension* SuperClassExtension = SuperClass->GetExtension<UMDFastBindingWidgetClassExtension>();
+		Containers.Add(SuperClassExtension != nullptr ? SuperClassExtension->GetBindingContainer() : nullptr);
+
+		SuperClass = Cast<UWidgetBlueprintGeneratedClass>(SuperClass->GetSuperClass());
+	}
+
+	return Containers;
+}
 #endif
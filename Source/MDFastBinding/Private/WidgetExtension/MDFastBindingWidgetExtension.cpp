@@ -3,6 +3,9 @@
 #include "WidgetExtension/MDFastBindingWidgetExtension.h"
 
 #include "MDFastBindingContainer.h"
+#include "MDFastBindingDirtyQueue.h"
+#include "MDFastBindingStats.h"
+#include "MDFastBindingWidgetUpdateBatch.h"
 #include "Blueprint/UserWidget.h"
 #include "Widgets/IToolTip.h"
 
@@ -12,8 +15,26 @@ void UMDFastBindingWidgetExtension::Construct()
 
 	TickingContainers.Insert(false, 0, SuperBindingContainers.Num() + 1);
 
+#if WITH_EDITOR
+	// Child class bindings override super class bindings that set the same destination, like they do in flattened containers
+	if (SuperBindingContainers.Num() > 0)
+	{
+		TSet<FString> DestinationKeys;
+		for (int32 i = 0; i <= SuperBindingContainers.Num(); ++i)
+		{
+			if (UMDFastBindingContainer* Container = GetContainerAtIndex(i))
+			{
+				Container->RemoveOverriddenBindings(DestinationKeys);
+			}
+		}
+	}
+#endif
+
 	if (UUserWidget* UserWidget = GetUserWidget())
 	{
+		// Share one batch between all containers so widget properties written to by multiple containers only call their setter once
+		FMDFastBindingWidgetUpdateBatchScope WidgetUpdateBatch;
+
 		if (BindingContainer != nullptr)
 		{
 			BindingContainer->InitializeBindings(UserWidget);
@@ -82,12 +103,20 @@ bool UMDFastBindingWidgetExtension::RequiresTick() const
 
 void UMDFastBindingWidgetExtension::UpdateBindings()
 {
+	// Catch anything that was marked dirty from another thread since the start of the frame
+	if (!FMDFastBindingDirtyQueue::IsEmpty())
+	{
+		FMDFastBindingDirtyQueue::Drain();
+	}
+
 	if (UUserWidget* UserWidget = GetUserWidget())
 	{
+		FMDFastBindingWidgetUpdateBatchScope WidgetUpdateBatch;
+
 		for (TConstSetBitIterator<> It(TickingContainers); It; ++It)
 		{
 			const int32 Index = It.GetIndex();
-			UMDFastBindingContainer* Container = (Index == 0) ? BindingContainer : SuperBindingContainers[Index - 1];
+			UMDFastBindingContainer* Container = GetContainerAtIndex(Index);
 			if (Container != nullptr && Container->DoesNeedTick())
 			{
 				Container->UpdateBindings(UserWidget);
@@ -99,17 +128,36 @@ void UMDFastBindingWidgetExtension::UpdateBindings()
 
 void UMDFastBindingWidgetExtension::SetBindingContainer(const UMDFastBindingContainer* CDOBindingContainer)
 {
+	LLM_SCOPE_BYTAG(MDFastBinding);
+
 	BindingContainer = DuplicateObject(CDOBindingContainer, this);
+	if (BindingContainer != nullptr)
+	{
+		BindingContainer->SourceContainer = CDOBindingContainer;
+	}
 }
 
 void UMDFastBindingWidgetExtension::AddSuperBindingContainer(const UMDFastBindingContainer* SuperCDOBindingContainer)
 {
+	LLM_SCOPE_BYTAG(MDFastBinding);
+
 	if (UMDFastBindingContainer* SuperBindingContainer = DuplicateObject(SuperCDOBindingContainer, this))
 	{
+		SuperBindingContainer->SourceContainer = SuperCDOBindingContainer;
 		SuperBindingContainers.Add(SuperBindingContainer);
 	}
 }
 
+UMDFastBindingContainer* UMDFastBindingWidgetExtension::GetContainerAtIndex(int32 Index) const
+{
+	if (Index == 0)
+	{
+		return BindingContainer;
+	}
+
+	return SuperBindingContainers.IsValidIndex(Index - 1) ? SuperBindingContainers[Index - 1] : nullptr;
+}
+
 UClass* UMDFastBindingWidgetExtension::GetBindingOwnerClass() const
 {
 	if (const UUserWidget* Widget = GetUserWidget())
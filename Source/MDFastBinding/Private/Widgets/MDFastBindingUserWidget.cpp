@@ -2,6 +2,7 @@
 
 #include "Widgets/MDFastBindingUserWidget.h"
 #include "MDFastBindingContainer.h"
+#include "MDFastBindingStats.h"
 
 #if WITH_EDITOR
 #include "Editor/WidgetCompilerLog.h"
@@ -20,7 +21,9 @@ void UMDFastBindingUserWidget::NativeConstruct()
 		{
 			if (CDO->Bindings != nullptr)
 			{
+				LLM_SCOPE_BYTAG(MDFastBinding);
 				Bindings = DuplicateObject<UMDFastBindingContainer>(CDO->Bindings, this);
+				Bindings->SourceContainer = CDO->Bindings;
 			}
 		}
 	}
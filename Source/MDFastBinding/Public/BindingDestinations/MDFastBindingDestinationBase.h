@@ -24,6 +24,10 @@ public:
 
 #if WITH_EDITOR
 	bool IsActive() const;
+
+	// Identifies what this destination writes to when flattening class bindings, a child class binding replaces
+	// super class bindings with the same key. Empty if the destination can't be overridden.
+	virtual FString GetDestinationKey() const { return {}; }
 #endif
 
 protected:
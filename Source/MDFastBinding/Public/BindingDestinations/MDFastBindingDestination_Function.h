@@ -15,6 +15,8 @@ class MDFASTBINDING_API UMDFastBindingDestination_Function : public UMDFastBindi
 	GENERATED_BODY()
 
 public:
+	virtual void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const override;
+
 #if WITH_EDITORONLY_DATA
 	virtual bool DoesBindingItemDefaultToSelf(const FName& InItemName) const override;
 	virtual bool IsBindingItemWorldContextObject(const FName& InItemName) const override;
@@ -28,6 +30,8 @@ public:
 
 	UFunction* GetFunction();
 	void SetFunction(UFunction* Func, UClass* Scope);
+
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
 #endif
 
 #if WITH_EDITORONLY_DATA
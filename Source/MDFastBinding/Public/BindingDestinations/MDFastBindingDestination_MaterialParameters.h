@@ -0,0 +1,89 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "MDFastBindingDestination_MaterialParameters.generated.h"
+
+class UMaterialInstanceDynamic;
+class UTexture;
+
+UENUM()
+enum class EMDFastBindingMaterialParameterType : uint8
+{
+	Scalar,
+	Vector,
+	Texture
+};
+
+USTRUCT()
+struct MDFASTBINDING_API FMDFastBindingMaterialParameter
+{
+	GENERATED_BODY()
+
+public:
+	// The name of the parameter in the material, also used as the name of its input
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	FName ParameterName = NAME_None;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingMaterialParameterType ParameterType = EMDFastBindingMaterialParameterType::Scalar;
+};
+
+/**
+ * Set multiple parameters on a dynamic material instance, only pushing the parameters whose values changed
+ */
+UCLASS(collapseCategories, meta=(DisplayName = "Set Material Parameters"))
+class MDFASTBINDING_API UMDFastBindingDestination_MaterialParameters : public UMDFastBindingDestinationBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
+#endif
+
+protected:
+	virtual void InitializeDestination_Internal(UObject* SourceObject) override;
+	virtual void UpdateDestination_Internal(UObject* SourceObject) override;
+	virtual void TerminateDestination_Internal(UObject* SourceObject) override;
+
+	virtual void SetupBindingItems() override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	TArray<FMDFastBindingMaterialParameter> Parameters;
+
+private:
+	// The last value pushed to the bound material for a parameter
+	struct FParameterState
+	{
+		// Scalar and vector parameters are set by index after the first push
+		int32 ParameterIndex = INDEX_NONE;
+		bool bHasValue = false;
+		bool bIsMissing = false;
+
+		float ScalarValue = 0.f;
+		FLinearColor VectorValue = FLinearColor::Black;
+		TWeakObjectPtr<UTexture> TextureValue;
+	};
+
+	void BindMaterial(UMaterialInstanceDynamic* Material);
+	void PushParameter(UMaterialInstanceDynamic& Material, const FMDFastBindingMaterialParameter& Parameter, FParameterState& State, const FProperty* ValueProp, const void* ValuePtr);
+
+	TWeakObjectPtr<UMaterialInstanceDynamic> BoundMaterial;
+	TArray<FParameterState> ParameterStates;
+
+	UPROPERTY(Transient)
+	UMaterialInstanceDynamic* MaterialProperty = nullptr;
+
+	UPROPERTY(Transient)
+	float ScalarProperty = 0.f;
+
+	UPROPERTY(Transient)
+	FLinearColor VectorProperty = FLinearColor::Black;
+
+	UPROPERTY(Transient)
+	UTexture* TextureProperty = nullptr;
+};
@@ -17,6 +17,8 @@ class MDFASTBINDING_API UMDFastBindingDestination_Property : public UMDFastBindi
 public:
 	UMDFastBindingDestination_Property();
 
+	virtual void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const override;
+
 	bool IsUObjectPropertyOwner() const;
 	UObject* GetUObjectPropertyOwner(UObject* SourceObject);
 
@@ -27,6 +29,10 @@ public:
 
 	void SetFieldPath(const TArray<FFieldVariant>& Path);
 	TArray<FFieldVariant> GetFieldPath();
+
+	virtual FString GetDestinationKey() const override;
+
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
 #endif
 
 #if WITH_EDITORONLY_DATA
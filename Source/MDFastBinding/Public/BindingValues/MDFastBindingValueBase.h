@@ -3,6 +3,7 @@
 #pragma once
 
 #include "MDFastBindingObject.h"
+#include "MDFastBindingRecorder.h"
 #include "MDFastBindingValueBase.generated.h"
 
 class UMDFastBindingInstance;
@@ -17,28 +18,58 @@ class MDFASTBINDING_API UMDFastBindingValueBase : public UMDFastBindingObject
 
 public:
 	virtual void BeginDestroy() override;
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
 	void InitializeValue(UObject* SourceObject);
 	void TerminateValue(UObject* SourceObject);
 
 	TTuple<const FProperty*, void*> GetValue(UObject* SourceObject, bool& OutDidUpdate);
+	TTuple<const FProperty*, void*> GetCachedValue() const;
 #if WITH_EDITOR
-	TTuple<const FProperty*, void*> GetCachedValue() const { return CachedValue; }
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
 #endif
 	bool HasCachedValue() const { return CachedValue.Value != nullptr; }
 
+	// Incremented each time GetValue reports an update, so consumers can tell if a value changed without comparing it
+	uint32 GetValueVersion() const { return ValueVersion; }
+	bool IsCachedValueBorrowed() const { return bIsCachedValueBorrowed; }
+
 	virtual const FProperty* GetOutputProperty() { PURE_VIRTUAL(UMDFastBindingValueBase::GetValue, return nullptr;) }
 
 	virtual bool HasRunSuccessfully() const override { return HasCachedValue(); }
 
 	const FMDFastBindingItem* GetOwningBindingItem() const;
 
+	virtual void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const override;
+
 protected:
 	virtual void InitializeValue_Internal(UObject* SourceObject) {}
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) { PURE_VIRTUAL(UMDFastBindingValueBase::GetValue, return {};) }
 	virtual void TerminateValue_Internal(UObject* SourceObject) {}
 
+	// Nodes whose output lives in memory that outlasts the update (eg. a property on the source object) can return it here to skip copying it into the cached value.
+	// OutDidChange replaces the comparison against the cached copy, so only borrow when changes are known some other way (eg. field notifications).
+	// OutValueOwner is the object that owns the borrowed memory, the value is refreshed if it's destroyed.
+	// Return false to have GetValue_Internal called instead.
+	virtual bool GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner) { return false; }
+
 private:
+#if MDFASTBINDING_RECORDING_ENABLED
+	friend class FMDFastBindingRecorder;
+#endif
+
+	bool IsBorrowedValueValid() const;
+	void ReleaseCachedValue();
+
 	TTuple<const FProperty*, void*> CachedValue;
 
+	// When borrowed, CachedValue points into memory owned by BorrowedValueOwner instead of our own allocation
+	bool bIsCachedValueBorrowed = false;
+	// Set when our own copy of the value holds objects that need to be reported to the garbage collector
+	bool bCachedValueHasObjectReferences = false;
+	TWeakObjectPtr<UObject> BorrowedValueOwner;
+	uint32 BorrowedValueOwnerVersion = 0;
+
+	uint32 ValueVersion = 0;
+
 };
@@ -34,6 +34,7 @@ public:
 protected:
 	virtual void InitializeValue_Internal(UObject* SourceObject) override;
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual bool GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner) override;
 	virtual void TerminateValue_Internal(UObject* SourceObject) override;
 
 	virtual const FProperty* GetPathRootProperty() const override;
@@ -19,6 +19,9 @@ public:
 #if WITH_EDITORONLY_DATA
 	virtual FText GetDisplayName() override;
 #endif
+#if WITH_EDITOR
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
+#endif
 
 protected:
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
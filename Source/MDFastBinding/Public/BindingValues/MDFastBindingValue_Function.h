@@ -18,6 +18,8 @@ class MDFASTBINDING_API UMDFastBindingValue_Function : public UMDFastBindingValu
 public:
 	virtual const FProperty* GetOutputProperty() override;
 
+	virtual void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const override;
+
 #if WITH_EDITORONLY_DATA
 	virtual bool DoesBindingItemDefaultToSelf(const FName& InItemName) const override;
 	virtual bool IsBindingItemWorldContextObject(const FName& InItemName) const override;
@@ -31,6 +33,8 @@ public:
 
 	virtual void OnVariableRenamed(UClass* VariableClass, const FName& OldVariableName, const FName& NewVariableName) override;
 
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
+
 	UFunction* GetFunction();
 #endif
 
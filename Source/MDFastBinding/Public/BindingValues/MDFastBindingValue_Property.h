@@ -17,6 +17,8 @@ class MDFASTBINDING_API UMDFastBindingValue_Property : public UMDFastBindingValu
 public:
 	virtual const FProperty* GetOutputProperty() override;
 
+	virtual void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const override;
+
 	bool IsUObjectPropertyOwner() const;
 	UObject* GetUObjectPropertyOwner(UObject* SourceObject);
 
@@ -31,10 +33,14 @@ public:
 
 	void SetFieldPath(const TArray<FFieldVariant>& Path);
 	TArray<FFieldVariant> GetFieldPath();
+
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost) override;
 #endif
 
 protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual bool GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner) override;
 	virtual void* GetPropertyOwner(UObject* SourceObject);
 	virtual UStruct* GetPropertyOwnerStruct() const;
 
@@ -52,4 +58,12 @@ protected:
 
 	// A place to store the source object for the duration of a binding update
 	void* TempSourceObject = nullptr;
+
+private:
+	UMDFastBindingValueBase* GetPathRootValue() const;
+	bool CanBorrowFromPathRoot();
+
+	// Set when the path only reads struct members out of the path root node's value, which can then be borrowed from that node
+	bool bCanBorrowFromPathRoot = false;
+	uint32 BorrowedPathRootVersion = 0;
 };
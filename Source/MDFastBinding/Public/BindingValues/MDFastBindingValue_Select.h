@@ -21,6 +21,7 @@ public:
 
 protected:
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual bool GetBorrowedValue_Internal(UObject* SourceObject, TTuple<const FProperty*, void*>& OutValue, bool& OutDidChange, UObject*& OutValueOwner) override;
 	virtual void SetupBindingItems() override;
 	virtual void SetupExtendablePinBindingItem(int32 ItemIndex) override;
 
@@ -34,7 +35,12 @@ protected:
 private:
 	const FProperty* ResolveOutputProperty();
 
+	// Returns the name of the binding item whose value should be output, or NAME_None if nothing matched
+	FName FindSelectedItemName(UObject* SourceObject);
+
 	TWeakFieldPtr<const FProperty> ResolvedOutputProperty;
 
+	FName SelectedItemName = NAME_None;
+
 	TMap<int64, FName> EnumValueToPinNameMap;
 };
@@ -0,0 +1,47 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "MDFastBindingOwnerInterface.h"
+#include "MDFastBindingComponent.generated.h"
+
+class UMDFastBindingContainer;
+
+/**
+ * Runs a BindingContainer for a non-widget owner (eg. world-space nameplates, material or audio parameter drivers).
+ * Create a blueprint subclass to author its bindings. Components don't tick themselves, instead the world's
+ * UMDFastBindingTickSubsystem updates every component in the same tick group together.
+ */
+UCLASS(Abstract, Blueprintable, ClassGroup = (Bindings), meta = (BlueprintSpawnableComponent))
+class MDFASTBINDING_API UMDFastBindingComponent : public UActorComponent, public IMDFastBindingOwnerInterface
+{
+	GENERATED_BODY()
+
+public:
+	UMDFastBindingComponent();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual UClass* GetBindingOwnerClass() const override;
+
+	// Call this to manually update bindings if you know source data changed after this component's tick group
+	UFUNCTION(BlueprintCallable, Category = "Bindings")
+	void UpdateBindings();
+
+	bool DoesNeedTick() const;
+	void UpdateNeedsTick();
+
+	UMDFastBindingContainer* GetBindingContainer() const { return Bindings; }
+
+	ETickingGroup GetBindingTickGroup() const { return BindingTickGroup; }
+
+protected:
+	// The tick group to update bindings in, all binding components in the same group are updated together
+	UPROPERTY(EditDefaultsOnly, Category = "Bindings")
+	TEnumAsByte<ETickingGroup> BindingTickGroup = TG_PostUpdateWork;
+
+	UPROPERTY(Instanced, DuplicateTransient)
+	UMDFastBindingContainer* Bindings = nullptr;
+};
@@ -0,0 +1,51 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MDFastBindingTickSubsystem.generated.h"
+
+class UMDFastBindingComponent;
+class UMDFastBindingTickSubsystem;
+
+// Updates the bindings of every registered component in a tick group
+struct FMDFastBindingTickFunction : public FTickFunction
+{
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+
+	void UpdateBindings();
+
+	// Components are grouped by class, since components of the same class have the same bindings they're updated with UpdateBindingsBatched
+	TMap<TWeakObjectPtr<const UClass>, TArray<TWeakObjectPtr<UMDFastBindingComponent>>> ComponentsByClass;
+	int32 NumComponents = 0;
+};
+
+/**
+ * Owns one tick function per tick group used by binding components in this world,
+ * so hundreds of binding components cost a handful of tick functions instead of one each
+ */
+UCLASS()
+class MDFASTBINDING_API UMDFastBindingTickSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterComponent(UMDFastBindingComponent* Component);
+	void UnregisterComponent(UMDFastBindingComponent* Component);
+
+	// Re-enables the component's tick group if it went to sleep because none of its components needed to tick
+	void OnComponentNeedsTick(UMDFastBindingComponent* Component);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FMDFastBindingTickFunction* FindOrAddTickFunction(ETickingGroup TickGroup);
+
+	TMap<TEnumAsByte<ETickingGroup>, TUniquePtr<FMDFastBindingTickFunction>> TickFunctions;
+};
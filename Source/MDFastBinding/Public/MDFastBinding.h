@@ -17,6 +17,8 @@ public:
 	static void AddPropertySetter(TSharedRef<IMDFastBindingPropertySetter> InPropertySetter);
 
 	static bool CanSetProperty(const FProperty* DestinationProp, const FProperty* SourceProp);
+	// Returns the registered setter that handles this pair of properties, or null if they can only be set by the same type fallback
+	static const IMDFastBindingPropertySetter* FindPropertySetter(const FProperty* DestinationProp, const FProperty* SourceProp);
 	// Bypasses any Setter on the destination property
 	static void SetPropertyDirectly(const FProperty* DestinationProp, void* DestinationValuePtr, const FProperty* SourceProp, const void* SourceValuePtr);
 	// Respects the Setter on the destination property
@@ -25,4 +27,10 @@ public:
 private:
 	TArray<TSharedRef<IMDFastBindingPropertySetter>> PropertySetters;
 
+	FDelegateHandle BeginFrameHandle;
+	FDelegateHandle ReloadCompleteHandle;
+#if WITH_EDITOR
+	FDelegateHandle ObjectsReplacedHandle;
+#endif
+
 };
@@ -0,0 +1,49 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/SoftObjectPath.h"
+
+class UMDFastBindingObject;
+
+/**
+ * Streams in soft references that bindings convert to hard references, so unloaded assets don't yield null or a sync load.
+ * Loads are shared between every binding object that requests the same path and each requester is marked dirty when it completes.
+ */
+class MDFASTBINDING_API FMDFastBindingAsyncLoader
+{
+public:
+	// Starts loading Path (or joins the in-flight load) on behalf of the binding object currently being updated.
+	// Returns false if the load can't be tracked (no object is updating, off the game thread, or the path recently failed to load),
+	// in which case the caller should write null as it would have before.
+	static bool RequestLoad(const FSoftObjectPath& Path);
+
+	// Call when the binding object currently being updated has stored the loaded object at Path,
+	// the load's handle is released once every requester has stored it (or has been destroyed)
+	static void NotifyLoadConsumed(const FSoftObjectPath& Path);
+
+	static void CancelAllLoads();
+
+private:
+	friend struct FMDFastBindingAsyncLoadRequesterScope;
+
+	static UMDFastBindingObject* CurrentRequester;
+};
+
+// Marks a binding object as the requester of any loads started while it updates
+struct MDFASTBINDING_API FMDFastBindingAsyncLoadRequesterScope
+{
+	explicit FMDFastBindingAsyncLoadRequesterScope(UMDFastBindingObject* Requester)
+		: PreviousRequester(FMDFastBindingAsyncLoader::CurrentRequester)
+	{
+		FMDFastBindingAsyncLoader::CurrentRequester = Requester;
+	}
+
+	~FMDFastBindingAsyncLoadRequesterScope()
+	{
+		FMDFastBindingAsyncLoader::CurrentRequester = PreviousRequester;
+	}
+
+private:
+	UMDFastBindingObject* PreviousRequester = nullptr;
+};
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "MDFastBindingRecorder.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "UObject/Object.h"
 #include "MDFastBindingContainer.generated.h"
 
@@ -20,6 +22,10 @@ public:
 
 	void UpdateBindings(UObject* SourceObject);
 
+	// Updates the ticking bindings of containers that share the same layout (duplicates of the same class container),
+	// running each binding across all of the containers before moving on to the next binding
+	static void UpdateBindingsBatched(TArrayView<UMDFastBindingContainer* const> Containers, TArrayView<UObject* const> SourceObjects);
+
 	void TerminateBindings(UObject* SourceObject);
 
 	void SetBindingTickPolicy(UMDFastBindingInstance* Binding, bool bShouldTick);
@@ -33,10 +39,13 @@ public:
 	UE_DEPRECATED(all, "GetBindingOwnerClassDelegate is deprecated, the binding's outer object should implement IMDFastBindingOwnerInterface instead")
 	FSimpleDelegate GetBindingOwnerClassDelegate;
 
-// Editor only operations
-#if WITH_EDITORONLY_DATA
 	const TArray<UMDFastBindingInstance*>& GetBindings() const { return Bindings; }
 
+	// The class level container this runtime container was duplicated from, used to identify it in binding recordings and memory reports
+	TWeakObjectPtr<const UMDFastBindingContainer> SourceContainer;
+
+// Editor only operations
+#if WITH_EDITORONLY_DATA
 	UMDFastBindingInstance* AddBinding();
 	UMDFastBindingInstance* DuplicateBinding(UMDFastBindingInstance* InBinding);
 	bool DeleteBinding(UMDFastBindingInstance* InBinding);
@@ -46,6 +55,18 @@ public:
 
 #if WITH_EDITOR
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+
+	// Validates like IsDataValid but skips bindings that haven't changed since they were last validated
+	EDataValidationResult IsDataValidCached(TArray<FText>& ValidationErrors);
+
+	// Appends duplicates of SourceContainer's bindings, skipping bindings whose destination key is in InOutDestinationKeys,
+	// then adds SourceContainer's destination keys so bindings appended later (from super classes) can be overridden by them
+	void AppendFlattenedBindings(const UMDFastBindingContainer* SourceContainer, TSet<FString>& InOutDestinationKeys);
+
+	// Applies the same overrides to a runtime container that is kept per class, call on the most derived class's container first.
+	// Removes bindings whose destination key is in InOutDestinationKeys, then adds the remaining bindings' destination keys.
+	// Must be called before InitializeBindings.
+	void RemoveOverriddenBindings(TSet<FString>& InOutDestinationKeys);
 #endif
 
 protected:
@@ -57,4 +78,10 @@ protected:
 
 private:
 	void UpdateNeedsTick();
+
+#if CPUPROFILERTRACE_ENABLED
+	uint32 GetTraceSpecId() const;
+
+	mutable uint32 TraceSpecId = 0;
+#endif
 };
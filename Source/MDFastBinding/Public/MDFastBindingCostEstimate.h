@@ -0,0 +1,38 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FFieldVariant;
+
+/**
+ * Static estimate of what it costs to update a binding, built from the shape of its node graph.
+ * The weights are rough per-operation timings meant for comparing bindings against each other, not a measurement.
+ */
+struct MDFASTBINDING_API FMDFastBindingCostEstimate
+{
+	int32 NumNodes = 0;
+	int32 NumPathHops = 0;
+	int32 MaxPathDepth = 0;
+	int32 NumFunctionCalls = 0;
+	int32 NumContainerCopies = 0;
+	int32 NumTextFormats = 0;
+	int32 NumSetterCalls = 0;
+
+	// True if any node in the binding updates every tick
+	bool bTicks = false;
+
+	// Adds a property path, function hops in the path are counted as function calls
+	void AddPath(const TArray<FFieldVariant>& Path);
+
+	double GetMicrosecondsPerUpdate() const;
+
+	// Bindings that don't tick only pay their update cost when something marks them dirty
+	double GetMicrosecondsPerFrame() const { return bTicks ? GetMicrosecondsPerUpdate() : 0.0; }
+
+	// Short summary, eg. "~1.2 us/frame"
+	FText GetSummaryText() const;
+	// Multi-line breakdown of what contributed to the estimate
+	FText GetBreakdownText() const;
+};
@@ -0,0 +1,23 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/WeakObjectPtr.h"
+
+class UMDFastBindingObject;
+
+/**
+ * Lock-free multi-producer, single-consumer queue of binding objects that were marked dirty off the game thread.
+ * Producers only copy a weak pointer into the queue, the objects are marked dirty when the game thread drains it.
+ */
+class MDFASTBINDING_API FMDFastBindingDirtyQueue
+{
+public:
+	// Safe to call from any thread
+	static void Enqueue(const TWeakObjectPtr<UMDFastBindingObject>& Object);
+
+	// Marks all queued objects dirty, must be called from the game thread
+	static void Drain();
+
+	static bool IsEmpty();
+};
@@ -15,14 +15,18 @@
 
 #include "MDFastBindingFieldPath.generated.h"
 
+struct FMDFastBindingAllocatedMemory;
+
 DECLARE_DELEGATE_RetVal_OneParam(void*, FMDGetFieldPathOwner, UObject*);
 DECLARE_DELEGATE_RetVal(UStruct*, FMDGetFieldPathOwnerStruct);
 DECLARE_DELEGATE_RetVal_OneParam(bool, FMDFilterFieldPathField, const FFieldVariant&);
 
-// Wraps FFieldVariant to weakly hold the field
+// Wraps FFieldVariant to weakly hold the field in the editor, where classes are recompiled out from under us.
+// Outside the editor the field is held directly, paths are rebuilt through FMDFastBindingFieldPath::InvalidateAllPaths when code is reloaded.
 struct FMDFastBindingWeakFieldVariant
 {
 public:
+#if WITH_EDITORONLY_DATA
 	FMDFastBindingWeakFieldVariant(const FField* InField)
 		: WeakField(InField)
 	{
@@ -73,8 +77,37 @@ public:
 		return {};
 	}
 
+	// The property holding the value this field resolves to (the return property for functions)
+	const FProperty* GetValueProperty() const { return ValueProperty.Get(); }
+	void SetValueProperty(const FProperty* InValueProperty) { ValueProperty = InValueProperty; }
+
 private:
 	TUnion<TWeakObjectPtr<UField>, TWeakFieldPtr<const FField>> WeakField;
+	TWeakFieldPtr<const FProperty> ValueProperty;
+#else
+	FMDFastBindingWeakFieldVariant(const FField* InField)
+		: Field(InField)
+	{
+	}
+
+	FMDFastBindingWeakFieldVariant(UField* InField)
+		: Object(InField)
+	{
+	}
+
+	bool IsFieldValid() const { return Field != nullptr || Object != nullptr; }
+	const FField* ToField() const { return Field; }
+	UObject* ToUObject() const { return Object; }
+	FFieldVariant GetFieldVariant() const { return Field != nullptr ? FFieldVariant(Field) : FFieldVariant(Object); }
+
+	const FProperty* GetValueProperty() const { return ValueProperty; }
+	void SetValueProperty(const FProperty* InValueProperty) { ValueProperty = InValueProperty; }
+
+private:
+	UField* Object = nullptr;
+	const FField* Field = nullptr;
+	const FProperty* ValueProperty = nullptr;
+#endif
 };
 
 /**
@@ -111,6 +144,12 @@ public:
 
 	FString ToString() const;
 
+	// Adds the memory allocated to hold function parameters and intermediate property values while resolving the path
+	void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const;
+
+	// Forces every field path to rebuild its cached fields the next time it's resolved, called when classes are reloaded
+	static void InvalidateAllPaths();
+
 #if WITH_EDITOR
 	void OnVariableRenamed(UClass* VariableClass, const FName& OldVariableName, const FName& NewVariableName);
 #endif
@@ -149,6 +188,7 @@ private:
 #endif
 
 	TArray<FMDFastBindingWeakFieldVariant> CachedPath;
+	uint32 CachedPathGeneration = 0;
 	TMap<TWeakObjectPtr<const UFunction>, void*> FunctionMemory;
 	TMap<TWeakFieldPtr<FProperty>, void*> PropertyMemory;
 };
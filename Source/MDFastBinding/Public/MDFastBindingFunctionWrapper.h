@@ -7,6 +7,8 @@
 
 #include "MDFastBindingFunctionWrapper.generated.h"
 
+struct FMDFastBindingAllocatedMemory;
+
 DECLARE_DELEGATE_RetVal_OneParam(UObject*, FMDGetFunctionOwner, UObject*);
 DECLARE_DELEGATE_RetVal(UClass*, FMDGetFunctionOwnerClass);
 DECLARE_DELEGATE_ThreeParams(FMDPopulateFunctionParam, UObject*, const FProperty*, void*);
@@ -38,6 +40,9 @@ public:
 
 	FName GetFunctionName() const { return FunctionMember.GetMemberName(); }
 
+	// Adds the memory allocated to hold the function's parameters
+	void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const;
+
 #if WITH_EDITORONLY_DATA
 	FString ToString();
 
@@ -8,7 +8,9 @@
 #include "MDFastBindingHelpers.generated.h"
 
 class FProperty;
+class FReferenceCollector;
 class UFunction;
+class UScriptStruct;
 class UWidgetBlueprintGeneratedClass;
 
 class MDFASTBINDING_API FMDFastBindingHelpers
@@ -21,6 +23,15 @@ public:
 
 	static bool ArePropertyValuesEqual(const FProperty* PropA, const void* ValuePtrA, const FProperty* PropB, const void* ValuePtrB);
 
+	// Returns true if all of the struct's state is visible to reflection, so it can be compared and copied member by member
+	static bool CanCopyStructMemberwise(const UScriptStruct* Struct);
+	// Copies only the members of SourceValuePtr that differ from DestinationValuePtr, falling back to a whole copy for structs
+	// that can't be copied member by member and a single memcpy for plain old data. Returns true if anything was copied.
+	static bool CopyStructValueDelta(const UScriptStruct* Struct, void* DestinationValuePtr, const void* SourceValuePtr);
+
+	// Reports the strong object references held in a property value that lives outside of any UObject (eg. a cached value)
+	static void AddReferencedObjectsInValue(FReferenceCollector& Collector, const FProperty* Prop, void* ValuePtr, const UObject* ReferencingObject);
+
 	static bool DoesClassHaveSuperClassBindings(UWidgetBlueprintGeneratedClass* Class);
 };
 
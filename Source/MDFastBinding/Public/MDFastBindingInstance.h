@@ -9,6 +9,7 @@ class UMDFastBindingContainer;
 class UMDFastBindingDestinationBase;
 class UMDFastBindingObject;
 class UMDFastBindingValueBase;
+struct FMDFastBindingCostEstimate;
 
 /**
  *
@@ -34,14 +35,23 @@ public:
 
 #if WITH_EDITOR
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+
+	// Returns the result of the last validation while this binding, its owner class and the classes its nodes reference are unchanged.
+	// LayoutHashes memoizes class layouts across the bindings validated in one pass.
+	EDataValidationResult IsDataValidCached(TArray<FText>& ValidationErrors, TMap<const UStruct*, uint64>& LayoutHashes);
+
 	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
 	virtual void PostDuplicate(EDuplicateMode::Type DuplicateMode) override;
+	virtual void PostEditUndo() override;
 
 	void OnVariableRenamed(UClass* VariableClass, const FName& OldVariableName, const FName& NewVariableName);
 
 	// Returns false if any nodes use the `Always` update type
 	bool IsBindingPerformant() const;
 
+	// Estimates the cost of updating this binding from the nodes that run each update
+	FMDFastBindingCostEstimate EstimateCost() const;
+
 	int32 GetBindingIndex() const;
 	void MoveToIndex(int32 Index);
 #endif
@@ -59,7 +69,15 @@ public:
 	void SetBindingDisplayName(const FText& InText);
 
 	UMDFastBindingObject* FindBindingObjectWithGUID(const FGuid& Guid) const;
-	TArray<UMDFastBindingObject*> GatherAllBindingObjects() const;
+
+	// Every node in the binding (connected, orphaned and inactive destinations) breadth first from the destination,
+	// cached until the binding's structure changes
+	const TArray<UMDFastBindingObject*>& GetAllBindingObjects() const;
+	TArray<UMDFastBindingObject*> GatherAllBindingObjects() const { return GetAllBindingObjects(); }
+
+	// Call after nodes are added, removed, reconnected or given new identifiers so the node list and guid index are rebuilt on next use
+	void MarkStructureChanged() { ++StructureVersion; }
+	uint32 GetStructureVersion() const { return StructureVersion; }
 
 	UPROPERTY(Instanced)
 	TArray<UMDFastBindingValueBase*> OrphanedValues;
@@ -71,8 +89,16 @@ public:
 	FString BindingName;
 
 private:
-	UPROPERTY(Transient)
+	void RebuildBindingObjectIndex() const;
+
+	UPROPERTY(Transient, DuplicateTransient)
+	mutable TArray<UMDFastBindingObject*> AllBindingObjects;
+
+	UPROPERTY(Transient, DuplicateTransient)
 	mutable TMap<FGuid, TWeakObjectPtr<UMDFastBindingObject>> GuidToBindingObjectMap;
+
+	uint32 StructureVersion = 0;
+	mutable uint32 IndexedStructureVersion = MAX_uint32;
 public:
 #endif
 
@@ -83,4 +109,10 @@ protected:
 private:
 	UPROPERTY()
 	bool bIsBindingPerformant = false;
+
+#if WITH_EDITORONLY_DATA
+	uint64 ValidationCacheKey = 0;
+	EDataValidationResult CachedValidationResult = EDataValidationResult::NotValidated;
+	TArray<FText> CachedValidationErrors;
+#endif
 };
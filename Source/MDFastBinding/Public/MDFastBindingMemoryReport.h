@@ -0,0 +1,44 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOutputDevice;
+class FProperty;
+
+// Heap memory held by binding nodes outside of their UObjects
+struct MDFASTBINDING_API FMDFastBindingAllocatedMemory
+{
+	SIZE_T NumBytes = 0;
+	int32 NumAllocations = 0;
+
+	void AddAllocation(SIZE_T Bytes)
+	{
+		NumBytes += Bytes;
+		++NumAllocations;
+	}
+
+	// Adds an allocation holding a single value, plus the heap memory its strings and containers own
+	void AddPropertyValue(const FProperty* Property, const void* ValuePtr);
+
+	// Adds the heap memory owned by the strings and containers within a value, not following object references
+	void AddNestedAllocations(const FProperty* Property, const void* ValuePtr);
+
+	FMDFastBindingAllocatedMemory& operator+=(const FMDFastBindingAllocatedMemory& Other)
+	{
+		NumBytes += Other.NumBytes;
+		NumAllocations += Other.NumAllocations;
+		return *this;
+	}
+};
+
+/**
+ * Reports the memory held by the binding containers that owners duplicated at runtime, per owner class and per binding,
+ * along with the largest cached values. Run with MDFastBinding.MemReport.
+ */
+class MDFASTBINDING_API FMDFastBindingMemoryReport
+{
+public:
+	static void Report(FOutputDevice& Ar, int32 NumLargestValues = 10);
+};
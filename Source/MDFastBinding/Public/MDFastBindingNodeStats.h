@@ -0,0 +1,38 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITORONLY_DATA
+// Running totals for a binding node, only gathered while recording is enabled (eg. by the binding editor's heat map)
+struct MDFASTBINDING_API FMDFastBindingNodeStats
+{
+	uint64 NumEvaluations = 0;
+	uint64 NumChanges = 0;
+	// Time spent updating the node, not including the time spent updating its binding items
+	uint64 ExclusiveCycles = 0;
+
+	static bool IsRecording() { return bIsRecording; }
+	static void SetRecording(bool bInIsRecording) { bIsRecording = bInIsRecording; }
+
+private:
+	static bool bIsRecording;
+};
+
+// Records an evaluation of a node into its stats, nested scopes subtract their time from the enclosing scope
+struct MDFASTBINDING_API FMDFastBindingNodeStatsScope : public FNoncopyable
+{
+	explicit FMDFastBindingNodeStatsScope(FMDFastBindingNodeStats& InStats);
+	~FMDFastBindingNodeStatsScope();
+
+	void MarkChanged();
+
+private:
+	// Null if we weren't recording when the scope opened
+	FMDFastBindingNodeStats* Stats = nullptr;
+	FMDFastBindingNodeStatsScope* OuterScope = nullptr;
+	uint64 StartCycles = 0;
+	uint64 InnerCycles = 0;
+};
+#endif
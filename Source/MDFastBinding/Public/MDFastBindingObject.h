@@ -2,15 +2,22 @@
 
 #pragma once
 
+#include "MDFastBindingNodeStats.h"
 #include "Misc/Optional.h"
 #include "Misc/FrameValue.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "UObject/Object.h"
 #include "UObject/WeakFieldPtr.h"
+#include "Templates/Function.h"
+#include "Templates/RefCounting.h"
 #include "Templates/SubclassOf.h"
+#include <atomic>
 #include "MDFastBindingObject.generated.h"
 
 class UMDFastBindingValueBase;
 class UMDFastBindingInstance;
+struct FMDFastBindingAllocatedMemory;
+struct FMDFastBindingCostEstimate;
 
 // Determines both whether nodes should tick the binding and when to fetch new values
 UENUM()
@@ -27,6 +34,32 @@ enum class EMDFastBindingUpdateType
 	Once
 };
 
+// Property memory holding a binding item's default value, intrusively ref counted so items only hold a single pointer to it
+struct MDFASTBINDING_API FMDFastBindingItemDefaultValue : public FRefCountBase
+{
+	// InitializeValue is called once on the initialized property memory, the value can't be changed afterwards
+	FMDFastBindingItemDefaultValue(const FProperty* InProperty, TFunctionRef<void(void*)> InitializeValue);
+	virtual ~FMDFastBindingItemDefaultValue() override;
+
+	// Returns the value imported from DefaultString, shared with every other item with the same property and default string (eg. every instance of a widget)
+	static TRefCountPtr<FMDFastBindingItemDefaultValue> FindOrImportShared(const FProperty* InProperty, const FString& DefaultString);
+
+	const FProperty* GetProperty() const { return Property; }
+	const void* GetValuePtr() const { return Value; }
+	// True if this value is in the pool shared between binding items
+	bool IsShared() const { return bIsShared; }
+
+	// Adds the memory held by the pool of shared default values, which isn't attributed to any one binding item
+	static void AccumulateSharedMemory(FMDFastBindingAllocatedMemory& InOutMemory);
+
+private:
+	const FProperty* Property = nullptr;
+	void* Value = nullptr;
+	// The pool key of a shared value, so it can remove itself from the pool when the last item releases it
+	FString SharedDefaultString;
+	bool bIsShared = false;
+};
+
 // Represented as a pin in the binding editor graph
 USTRUCT()
 struct MDFASTBINDING_API FMDFastBindingItem
@@ -34,7 +67,13 @@ struct MDFASTBINDING_API FMDFastBindingItem
 	GENERATED_BODY()
 
 public:
-	~FMDFastBindingItem();
+	FMDFastBindingItem()
+		: bIsSelfPin(false)
+		, bIsWorldContextPin(false)
+		, bAllowNullValue(false)
+		, bHasRetrievedDefaultValue(false)
+	{
+	}
 
 	UPROPERTY(VisibleAnywhere, Category = "Bindings")
 	FName ItemName = NAME_None;
@@ -58,23 +97,23 @@ public:
 	FName ExtendablePinListNameBase = NAME_None;
 
 	UPROPERTY()
-	bool bIsSelfPin = false;
+	uint8 bIsSelfPin : 1;
 
 	UPROPERTY()
-	bool bIsWorldContextPin = false;
+	uint8 bIsWorldContextPin : 1;
+
+	uint8 bAllowNullValue : 1;
 
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Transient)
 	double LastUpdateTime = 0.0;
-#endif
 
 	FText DisplayName;
 	FText ToolTip;
+#endif
 
 	TWeakFieldPtr<const FProperty> ItemProperty;
 
-	bool bAllowNullValue = false;
-
 	bool operator==(const FName& InName) const
 	{
 		return ItemName == InName;
@@ -107,6 +146,9 @@ public:
 	// Resolves wildcard binding items (where ItemProperty is null, the output property of Value is used instead)
 	const FProperty* ResolveOutputProperty() const;
 
+	// Adds the default value memory owned by this item, shared default values are accounted for separately
+	void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const;
+
 #if WITH_EDITOR
 	void ForceDisplayItemName();
 #else
@@ -118,10 +160,13 @@ public:
 #endif
 
 private:
-	void* AllocatedDefaultValue = nullptr;
+	// Item values are only read by bindings, so the default value memory is handed out with the same type as node outputs
+	TTuple<const FProperty*, void*> GetDefaultValue() const;
+
+	TRefCountPtr<FMDFastBindingItemDefaultValue> DefaultValue;
 
 	UPROPERTY(Transient)
-	bool bHasRetrievedDefaultValue = false;
+	uint8 bHasRetrievedDefaultValue : 1;
 };
 
 /**
@@ -149,14 +194,29 @@ public:
 
 	// Indicate that an EventBased node needs to update
 	void MarkObjectDirty();
+	// Marks this object and everything downstream of it as needing an update, without causing the binding to tick
+	void MarkPathDirty();
+	// Can be called from any thread, if called off the game thread the node is marked dirty before the next binding update
+	void MarkObjectDirty_AnyThread();
 	void MarkObjectClean();
+	bool IsObjectDirty() const { return bIsObjectDirty; }
 
 	// Wrapper around CheckNeedsUpdate with a TFrameValue cache so that multiple calls in a frame are "free"
 	bool CheckCachedNeedsUpdate() const;
 
+#if CPUPROFILERTRACE_ENABLED
+	// Trace event type named after the owner class, binding and this object, shared by every node with the same name
+	uint32 GetTraceSpecId() const;
+#endif
+
 	const FMDFastBindingItem* FindBindingItemWithValue(const UMDFastBindingValueBase* Value) const;
 	const FMDFastBindingItem* FindBindingItem(const FName& ItemName) const;
 	FMDFastBindingItem* FindBindingItem(const FName& ItemName);
+	const TArray<FMDFastBindingItem>& GetBindingItems() const { return BindingItems; }
+
+	// Adds the heap memory this node holds outside of its UObject (eg. cached values and function parameters), not including the nodes connected to its binding items
+	virtual void AccumulateAllocatedMemory(FMDFastBindingAllocatedMemory& InOutMemory) const;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
 	static const FName& FindOrCreateExtendableItemName(const FName& Base, int32 Index);
 
@@ -186,10 +246,11 @@ public:
 	UPROPERTY(Transient)
 	double LastTimeNodeRan = 0.0;
 
+	FMDFastBindingNodeStats NodeStats;
+
 	virtual FText GetDisplayName();
 	virtual FText GetToolTipText();
 
-	const TArray<FMDFastBindingItem>& GetBindingItems() const { return BindingItems; }
 	TArray<FMDFastBindingItem>& GetBindingItems() { return BindingItems; }
 	void RemoveBindingItem(const FName& ItemName);
 	UMDFastBindingValueBase* SetBindingItem(const FName& ItemName, TSubclassOf<UMDFastBindingValueBase> ValueClass);
@@ -204,6 +265,9 @@ public:
 	void OrphanBindingItem(UMDFastBindingValueBase* InValue);
 	void OrphanAllBindingItems(const TSet<UObject*>& OrphanExclusionSet);
 
+	// Lets the outer binding know its node list and guid index need rebuilding
+	void MarkBindingStructureChanged() const;
+
 private:
 	UMDFastBindingValueBase* SetBindingItem_Internal(const FName& ItemName, UMDFastBindingValueBase* InValue);
 #endif
@@ -213,21 +277,36 @@ public:
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
 
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
 
 	virtual TSharedRef<class SWidget> CreateNodeHeaderWidget();
 
 	virtual void OnVariableRenamed(UClass* VariableClass, const FName& OldVariableName, const FName& NewVariableName);
 
+	// Adds what this node costs to update to the estimate, not including its binding items
+	virtual void AccumulateEstimatedCost(FMDFastBindingCostEstimate& InOutCost);
+
 	EMDFastBindingUpdateType GetUpdateType() const { return UpdateType; }
 
 	void SetUpdateType(EMDFastBindingUpdateType InUpdateType) { UpdateType = InUpdateType; }
 #endif
 
 protected:
+	virtual void PostInitProperties() override;
 	virtual void PostLoad() override;
 
 	virtual bool CheckNeedsUpdate() const;
 
+	// Links binding item values to this object for dirty propagation, must be called after the values have been initialized
+	void InitializeDirtyPropagation();
+	// Call before updating, dirty marks made during the update (eg. by inputs that failed) are kept when MarkObjectClean is called
+	void BeginUpdate();
+	// Updates the inputs that have to be polled each update, call before CheckCachedNeedsUpdate.
+	// Polled inputs mark our path dirty when their value changes, so we only update if one of them did.
+	void PollInputs(UObject* SourceObject);
+	// Call after an Always node has updated, pushes the change to the nodes that read it instead of having them update every time
+	void FinishPolledUpdate(bool bDidChange);
+
 	virtual void SetupBindingItems() {}
 
 	virtual void SetupExtendablePinBindingItem(int32 ItemIndex) {}
@@ -250,12 +329,40 @@ protected:
 	UPROPERTY(EditAnywhere, Config, Category = "Performance")
 	EMDFastBindingUpdateType UpdateType = EMDFastBindingUpdateType::IfUpdatesNeeded;
 
+	// If true, this node updates every time an Always node below it is polled instead of only when the polled value changed (how bindings used to behave).
+	// Use for nodes that depend on state that isn't one of their inputs.
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", AdvancedDisplay, meta = (EditCondition = "UpdateType == EMDFastBindingUpdateType::IfUpdatesNeeded"))
+	bool bUpdateWhenInputsArePolled = false;
+
 private:
+	friend class FMDFastBindingDirtyQueue;
+
+	void MarkDequeuedObjectDirty();
+
 	UPROPERTY(Transient)
 	bool bIsObjectDirty = false;
 
+	// Set on the game thread so that other threads can queue this object without resolving it
+	TWeakObjectPtr<UMDFastBindingObject> ThreadSafeWeakThis;
+	std::atomic<bool> bIsQueuedAsDirty { false };
+
 	mutable TFrameValue<bool> CachedNeedsUpdate;
 
+#if CPUPROFILERTRACE_ENABLED
+	mutable uint32 TraceSpecId = 0;
+#endif
+
+	// The object that reads our value, set when initialized
+	UMDFastBindingObject* DownstreamObject = nullptr;
+	bool bIsDirtyPropagationInitialized = false;
+	// True if this object or any of its inputs has to be polled each update, which PollInputs does before checking dirty marks
+	bool bSubtreePolls = false;
+
+	// We need an update if we've been marked dirty since the start of our last successful update
+	uint64 DirtyEpoch = 0;
+	uint64 CleanEpoch = 0;
+	uint64 UpdateStartEpoch = 0;
+
 	mutable TWeakObjectPtr<UClass> BindingOwnerClass;
 	mutable TWeakObjectPtr<UMDFastBindingInstance> OuterBinding;
 };
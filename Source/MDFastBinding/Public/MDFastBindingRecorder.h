@@ -0,0 +1,74 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifndef MDFASTBINDING_RECORDING_ENABLED
+#define MDFASTBINDING_RECORDING_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+#if MDFASTBINDING_RECORDING_ENABLED
+
+class FArchive;
+class FProperty;
+class UMDFastBindingContainer;
+class UMDFastBindingInstance;
+class UMDFastBindingObject;
+class UMDFastBindingValueBase;
+
+/**
+ * Streams the values produced by source nodes (value nodes without bound inputs) and the dirty events raised on binding nodes
+ * to a file, one frame marker per engine frame, so a gameplay session can be re-driven offline with FMDFastBindingReplay.
+ * Only containers duplicated at runtime from a class level container are recorded.
+ */
+class MDFASTBINDING_API FMDFastBindingRecorder
+{
+public:
+	static bool IsRecording() { return Writer != nullptr; }
+
+	static bool StartRecording(const FString& FilePath);
+	static void StopRecording();
+
+	static void RecordValue(const UMDFastBindingValueBase& Value);
+	static void RecordDirty(const UMDFastBindingObject& Object);
+
+	// Nodes are identified within their binding by their order in a depth-first walk from the destination,
+	// which is stable between a class level binding and its runtime duplicates
+	static void GatherNodes(const UMDFastBindingInstance& Binding, TArray<UMDFastBindingObject*>& OutNodes);
+
+private:
+	static bool IsSourceNode(const UMDFastBindingValueBase& Value);
+	static bool TryGetNodeId(const UMDFastBindingObject& Object, uint32& OutNodeId);
+	static void WriteValue(uint32 NodeId, const FProperty* Property, const void* ValuePtr);
+	static void OnEndFrame();
+
+	static FArchive* Writer;
+};
+
+/**
+ * Re-drives the containers captured by FMDFastBindingRecorder headlessly, each against a stand-in owner object created from the
+ * recorded owner class, feeding recorded values into the source nodes and timing each update pass.
+ */
+class MDFASTBINDING_API FMDFastBindingReplay
+{
+public:
+	struct FResult
+	{
+		int32 NumContainers = 0;
+		int32 NumFrames = 0;
+		int32 NumIterations = 0;
+		double InitializeMicroseconds = 0.0;
+		double AverageMicrosecondsPerFrame = 0.0;
+		double MaxMicrosecondsPerFrame = 0.0;
+	};
+
+	static bool Run(const FString& FilePath, int32 NumIterations, FResult& OutResult);
+
+	static bool IsReplaying();
+
+	// Returns true and the recorded value if Value is a source node being driven by the active replay
+	static bool FindValueOverride(const UMDFastBindingValueBase& Value, TTuple<const FProperty*, void*>& OutValue);
+};
+
+#endif
@@ -0,0 +1,18 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/LowLevelMemTracker.h"
+#include "Stats/Stats.h"
+
+// Low level memory tag for everything bindings allocate at runtime: duplicated containers, cached values, default values and call memory
+LLM_DECLARE_TAG_API(MDFastBinding, MDFASTBINDING_API);
+
+DECLARE_STATS_GROUP(TEXT("MDFastBinding"), STATGROUP_MDFastBinding, STATCAT_Advanced);
+
+// Number of times a binding wrote to a property on a UMG widget this frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widget Property Writes"), STAT_MDFastBinding_WidgetWrites, STATGROUP_MDFastBinding, MDFASTBINDING_API);
+// Number of widget setter calls that were deferred into a widget update batch this frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Widget Property Writes"), STAT_MDFastBinding_BatchedWidgetWrites, STATGROUP_MDFastBinding, MDFASTBINDING_API);
+// Number of slate widget invalidations caused by bindings this frame (one per setter call, deferred writes to the same property in a batch share one call)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widget Invalidations"), STAT_MDFastBinding_WidgetInvalidations, STATGROUP_MDFastBinding, MDFASTBINDING_API);
@@ -0,0 +1,31 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#if CPUPROFILERTRACE_ENABLED
+
+// Binding scopes are only traced while both this and the cpu channel are enabled (eg. -trace=cpu,mdfastbinding)
+UE_TRACE_CHANNEL_EXTERN(MDFastBindingChannel, MDFASTBINDING_API);
+
+struct MDFASTBINDING_API FMDFastBindingTrace
+{
+	// Returns the cpu profiler event type for Name, outputting it the first time the name is seen.
+	// Runtime duplicates of the same binding share their names, so they share one event type.
+	static uint32 GetEventType(const FString& Name);
+};
+
+#define MDFASTBINDING_TRACE_ENABLED() bool(MDFastBindingChannel | CpuChannel)
+
+// Opens a cpu profiler scope with an event type interned by the caller, SpecIdExpr is only evaluated while tracing
+#define MDFASTBINDING_TRACE_SCOPE(SpecIdExpr) \
+	const bool PREPROCESSOR_JOIN(bMDFastBindingTraceEnabled, __LINE__) = MDFASTBINDING_TRACE_ENABLED(); \
+	FCpuProfilerTrace::FEventScope PREPROCESSOR_JOIN(MDFastBindingTraceScope, __LINE__)(PREPROCESSOR_JOIN(bMDFastBindingTraceEnabled, __LINE__) ? (SpecIdExpr) : 0, MDFastBindingChannel, PREPROCESSOR_JOIN(bMDFastBindingTraceEnabled, __LINE__))
+
+#else
+
+#define MDFASTBINDING_TRACE_ENABLED() false
+#define MDFASTBINDING_TRACE_SCOPE(SpecIdExpr)
+
+#endif
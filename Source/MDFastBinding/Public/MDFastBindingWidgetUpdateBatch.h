@@ -0,0 +1,50 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
+#include "FieldNotificationId.h"
+#else
+#include "FieldNotification/FieldId.h"
+#endif
+
+class FProperty;
+class UObject;
+
+/**
+ * Coalesces the setter calls bindings make on UMG widget properties during an update pass. Each widget property written to
+ * while a batch is open keeps only its last value, and its setter (which is what invalidates the widget) is called once when the batch closes.
+ * Properties without setters are written immediately, same as outside of a batch.
+ */
+class MDFASTBINDING_API FMDFastBindingWidgetUpdateBatch
+{
+public:
+	static bool IsBatching();
+
+	// Stores the value for a widget property with a setter and defers calling the setter until the batch closes,
+	// FieldId is broadcast after the setter is called if it's valid.
+	// Returns false if the write can't be batched, in which case the caller is expected to set the property normally.
+	static bool TrySetWidgetProperty(UObject* PropertyOwner, const FProperty* DestinationProp, const FProperty* SourceProp, const void* SourceValuePtr, const UE::FieldNotification::FFieldId& FieldId);
+
+private:
+	friend struct FMDFastBindingWidgetUpdateBatchScope;
+
+	static void OpenBatch();
+	static void CloseBatch();
+};
+
+// Opens a widget update batch for its lifetime, nested scopes are flushed when the outermost scope closes
+struct MDFASTBINDING_API FMDFastBindingWidgetUpdateBatchScope
+{
+	FMDFastBindingWidgetUpdateBatchScope()
+	{
+		FMDFastBindingWidgetUpdateBatch::OpenBatch();
+	}
+
+	~FMDFastBindingWidgetUpdateBatchScope()
+	{
+		FMDFastBindingWidgetUpdateBatch::CloseBatch();
+	}
+};
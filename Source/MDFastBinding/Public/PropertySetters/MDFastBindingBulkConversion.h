@@ -0,0 +1,49 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FProperty;
+
+/**
+ * Converts contiguous runs of numeric or color values in a single pass, used by container setters when the element types differ
+ * so that large arrays don't have to go through the property setters one element at a time
+ */
+class MDFASTBINDING_API FMDFastBindingBulkConversion
+{
+public:
+	static bool CanConvert(const FProperty& DestinationElementProp, const FProperty& SourceElementProp);
+
+	// Converts Num elements from SourceElements into the already initialized DestinationElements.
+	// Returns false if there's no bulk conversion between the element types, in which case nothing is written.
+	static bool Convert(const FProperty& DestinationElementProp, void* DestinationElements, const FProperty& SourceElementProp, const void* SourceElements, int32 Num);
+
+	// FLinearColor to FColor without sRGB conversion, matching FLinearColor::ToFColor(false)
+	static void ConvertLinearColorsToColors(FColor* DestinationColors, const FLinearColor* SourceColors, int32 Num);
+	// FColor to FLinearColor with sRGB conversion, matching the FLinearColor(FColor) constructor
+	static void ConvertColorsToLinearColors(FLinearColor* DestinationColors, const FColor* SourceColors, int32 Num);
+
+	// Casting NaN or out of range floating point values to an integer is undefined, so clamp to the integer's range (NaN becomes 0)
+	template<typename IntegerType>
+	static IntegerType SaturateToInteger(double Value)
+	{
+		if (FMath::IsNaN(Value))
+		{
+			return 0;
+		}
+
+		// The limits may round up when converted to double (eg. int64 max), so anything at or past them is clamped
+		if (Value <= static_cast<double>(TNumericLimits<IntegerType>::Lowest()))
+		{
+			return TNumericLimits<IntegerType>::Lowest();
+		}
+
+		if (Value >= static_cast<double>(TNumericLimits<IntegerType>::Max()))
+		{
+			return TNumericLimits<IntegerType>::Max();
+		}
+
+		return static_cast<IntegerType>(Value);
+	}
+};
@@ -29,9 +29,29 @@ public:
 	virtual void Construct(UUserWidget* UserWidget) override;
 
 	void SetBindingContainer(UMDFastBindingContainer* BPBindingContainer);
+
+	// Merges this class's bindings with the bindings of its super classes into a single container at compile time,
+	// so instances duplicate, initialize and update one container instead of one per class in the hierarchy
+	void BuildFlattenedBindingContainer();
 #endif
 
 private:
+	bool ShouldUseFlattenedBindings(const UUserWidget& UserWidget);
+
+#if WITH_EDITOR
+	// This class's container followed by its super classes' containers, null entries for classes without an extension
+	TArray<const UMDFastBindingContainer*> GatherClassBindingContainers() const;
+#endif
+
 	UPROPERTY(Instanced)
 	TObjectPtr<UMDFastBindingContainer> BindingContainer = nullptr;
+
+	// This class's bindings followed by its super classes' bindings, null if no super classes have bindings
+	UPROPERTY(Instanced)
+	TObjectPtr<UMDFastBindingContainer> FlattenedBindingContainer = nullptr;
+
+#if WITH_EDITORONLY_DATA
+	// The class containers FlattenedBindingContainer was built from, to rebuild it when a super class is recompiled
+	TArray<TWeakObjectPtr<const UMDFastBindingContainer>> FlattenedSourceContainers;
+#endif
 };
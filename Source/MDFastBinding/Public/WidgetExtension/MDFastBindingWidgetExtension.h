@@ -44,6 +44,9 @@ protected:
 	void AddSuperBindingContainer(const UMDFastBindingContainer* SuperCDOBindingContainer);
 
 private:
+	// Index 0 is BindingContainer, SuperBindingContainers starts from Index 1
+	UMDFastBindingContainer* GetContainerAtIndex(int32 Index) const;
+
 	UPROPERTY(Instanced)
 	TObjectPtr<UMDFastBindingContainer> BindingContainer = nullptr;
 
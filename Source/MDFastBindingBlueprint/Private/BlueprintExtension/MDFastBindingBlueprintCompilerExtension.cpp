@@ -33,6 +33,7 @@ void UMDFastBindingBlueprintCompilerExtension::ProcessBlueprintCompiled(const FK
 					);
 
 					UMDFastBindingWidgetClassExtension* BindingClassExtension = NewObject<UMDFastBindingWidgetClassExtension>(WidgetClass);
+					BindingClassExtension->BuildFlattenedBindingContainer();
 					WidgetCompilationContext.AddExtension(WidgetClass, BindingClassExtension);
 				}
 			}
@@ -7,6 +7,7 @@
 #include "MDFastBindingContainer.h"
 #include "MDFastBindingHelpers.h"
 #include "MDFastBindingInstance.h"
+#include "MDFastBindingObject.h"
 #include "WidgetExtension/MDFastBindingWidgetClassExtension.h"
 
 void UMDFastBindingWidgetBlueprintExtension::SetBindingContainer(UMDFastBindingContainer* InContainer)
@@ -30,6 +31,14 @@ bool UMDFastBindingWidgetBlueprintExtension::DoesBlueprintOrSuperClassesHaveBind
 	return false;
 }
 
+void UMDFastBindingWidgetBlueprintExtension::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	ObjectModifiedHandle.Reset();
+}
+
 #if WITH_EDITORONLY_DATA
 void UMDFastBindingWidgetBlueprintExtension::GetAllGraphs(TArray<UEdGraph*>& Graphs) const
 {
@@ -45,8 +54,6 @@ void UMDFastBindingWidgetBlueprintExtension::HandleBeginCompilation(FWidgetBluep
 {
 	Super::HandleBeginCompilation(InCreationContext);
 
-	PinnedGraphs.Empty();
-
 	CompilerContext = &InCreationContext;
 }
 
@@ -63,8 +70,8 @@ void UMDFastBindingWidgetBlueprintExtension::HandleCopyTermDefaultsToDefaultObje
 			{
 				BindingClass->SetBindingContainer(BindingContainer);
 			}
-		
-			// There's a chance we could perform some compile-time steps here that would improve runtime performance
+
+			BindingClass->BuildFlattenedBindingContainer();
 			CompilerContext->AddExtension(WidgetBPClass, BindingClass);
 
 			// The blueprint has been fully recompiled here, we need to update the binding graphs
@@ -81,7 +88,7 @@ bool UMDFastBindingWidgetBlueprintExtension::HandleValidateGeneratedClass(UWidge
 	}
 
 	TArray<FText> ValidationErrors;
-	if (BindingContainer->IsDataValid(ValidationErrors) == EDataValidationResult::Invalid)
+	if (BindingContainer->IsDataValidCached(ValidationErrors) == EDataValidationResult::Invalid)
 	{
 		return false;
 	}
@@ -111,17 +118,79 @@ void UMDFastBindingWidgetBlueprintExtension::HandleEndCompilation()
 
 void UMDFastBindingWidgetBlueprintExtension::PopulatePinnedGraphs()
 {
-	if (PinnedGraphs.IsEmpty() && BindingContainer != nullptr)
-	{	
-		// Since we don't serialize the binding graphs, we need to generate them on the fly
-		for (UMDFastBindingInstance* BindingInstance : BindingContainer->GetBindings())
+	if (BindingContainer == nullptr)
+	{
+		PinnedGraphs.Empty();
+		ModifiedBindings.Reset();
+		return;
+	}
+
+	if (!ObjectModifiedHandle.IsValid())
+	{
+		ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &UMDFastBindingWidgetBlueprintExtension::OnObjectModified);
+	}
+
+	// Graphs of bindings that still exist are kept, so only new bindings create graphs and only modified bindings refresh theirs
+	TMap<UMDFastBindingInstance*, UMDFastBindingGraph*> ExistingGraphs;
+	for (UMDFastBindingGraph* GraphObj : PinnedGraphs)
+	{
+		if (GraphObj != nullptr && GraphObj->GetBinding() != nullptr)
+		{
+			ExistingGraphs.Add(GraphObj->GetBinding(), GraphObj);
+		}
+	}
+
+	PinnedGraphs.Reset();
+
+	// Since we don't serialize the binding graphs, we need to generate them on the fly
+	for (UMDFastBindingInstance* BindingInstance : BindingContainer->GetBindings())
+	{
+		if (BindingInstance == nullptr)
+		{
+			continue;
+		}
+
+		const FName GraphName = *FString::Printf(TEXT("FastBinding: %s"), *BindingInstance->GetBindingDisplayName().ToString());
+		UMDFastBindingGraph* GraphObj = ExistingGraphs.FindRef(BindingInstance);
+		if (GraphObj != nullptr)
 		{
-			const FString GraphName = FString::Printf(TEXT("FastBinding: %s"), *BindingInstance->GetBindingDisplayName().ToString());
-			UMDFastBindingGraph* GraphObj = NewObject<UMDFastBindingGraph>(GetWidgetBlueprint(), FName(*GraphName), RF_Transient);
+			if (GraphObj->GetFName() != GraphName && StaticFindObjectFast(nullptr, GetWidgetBlueprint(), GraphName) == nullptr)
+			{
+				GraphObj->Rename(*GraphName.ToString(), nullptr, REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty);
+			}
+
+			if (ModifiedBindings.Contains(BindingInstance))
+			{
+				GraphObj->RefreshGraph();
+			}
+		}
+		else
+		{
+			GraphObj = NewObject<UMDFastBindingGraph>(GetWidgetBlueprint(), GraphName, RF_Transient);
 			GraphObj->Schema = UMDFastBindingGraphSchema::StaticClass();
 			GraphObj->SetBinding(BindingInstance);
-			PinnedGraphs.Add(GraphObj);
 		}
+
+		PinnedGraphs.Add(GraphObj);
+	}
+
+	ModifiedBindings.Reset();
+}
+
+void UMDFastBindingWidgetBlueprintExtension::OnObjectModified(UObject* Object)
+{
+	if (Object == nullptr || BindingContainer == nullptr || !Object->IsIn(BindingContainer))
+	{
+		return;
+	}
+
+	if (UMDFastBindingInstance* BindingInstance = Cast<UMDFastBindingInstance>(Object))
+	{
+		ModifiedBindings.Add(BindingInstance);
+	}
+	else if (const UMDFastBindingObject* BindingObject = Cast<UMDFastBindingObject>(Object))
+	{
+		ModifiedBindings.Add(BindingObject->GetOuterBinding());
 	}
 }
 
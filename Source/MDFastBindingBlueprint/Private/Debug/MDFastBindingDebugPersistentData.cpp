@@ -2,6 +2,8 @@
 
 #include "Debug/MDFastBindingDebugPersistentData.h"
 
+#include "MDFastBindingNodeStats.h"
+
 bool UMDFastBindingDebugPersistentData::IsNodeBeingWatched(const FGuid& NodeId) const
 {
 	if (const FMDFastBindingEditorPinWatchList* WatchList = NodePinWatchList.Find(NodeId))
@@ -57,3 +59,14 @@ void UMDFastBindingDebugPersistentData::RemoveNodeFromWatchList(const FGuid& Nod
 		OnWatchListChanged.Broadcast();
 	}
 }
+
+void UMDFastBindingDebugPersistentData::SetHeatMapEnabled(bool bInIsEnabled)
+{
+	if (bIsHeatMapEnabled != bInIsEnabled)
+	{
+		bIsHeatMapEnabled = bInIsEnabled;
+		FMDFastBindingNodeStats::SetRecording(bIsHeatMapEnabled);
+
+		SaveConfig();
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "Debug/MDFastBindingEditorDebug.h"
 
+#include "BindingValues/MDFastBindingValueBase.h"
 #include "BlueprintEditor.h"
 #include "Debug/MDFastBindingDebugPersistentData.h"
 #include "EdGraphSchema_K2.h"
@@ -23,7 +24,7 @@ bool FMDFastBindingDebugLineItemBase::HasChildren() const
 
 void FMDFastBindingDebugLineItemBase::GatherChildrenBase(TArray<FDebugTreeItemPtr>& OutChildren, const FString& InSearchString, bool bRespectSearch)
 {
-	if (!CachedChildren.IsSet())
+	if (!CachedChildren.IsSet() || AreCachedChildrenStale())
 	{
 		UpdateCachedChildren();
 	}
@@ -161,7 +162,41 @@ const FProperty* FMDFastBindingDebugLineItem::GetItemProperty() const
 	return GetPropertyInstance().Key;
 }
 
+bool FMDFastBindingDebugLineItem::HasChildren() const
+{
+	// Counting container elements is cheap, their items aren't built until this item is expanded
+	const TTuple<const FProperty*, void*> PropertyInstance = GetPropertyInstance();
+	const FProperty* ItemProperty = GetItemProperty();
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(ItemProperty))
+	{
+		return PropertyInstance.Value != nullptr && FScriptArrayHelper(ArrayProp, PropertyInstance.Value).Num() > 0;
+	}
+	else if (const FSetProperty* SetProp = CastField<FSetProperty>(ItemProperty))
+	{
+		return PropertyInstance.Value != nullptr && FScriptSetHelper(SetProp, PropertyInstance.Value).Num() > 0;
+	}
+	else if (const FMapProperty* MapProp = CastField<FMapProperty>(ItemProperty))
+	{
+		return PropertyInstance.Value != nullptr && FScriptMapHelper(MapProp, PropertyInstance.Value).Num() > 0;
+	}
+
+	return FMDFastBindingDebugLineItemBase::HasChildren();
+}
+
 FText FMDFastBindingDebugLineItem::GetDisplayValue() const
+{
+	// Only rebuild the text when the value node reports a new value, untracked values are rebuilt every time
+	const TOptional<uint64> ValueKey = GetValueKey();
+	if (!ValueKey.IsSet() || ValueKey != CachedDisplayValueKey)
+	{
+		CachedDisplayValue = BuildDisplayValue();
+		CachedDisplayValueKey = ValueKey;
+	}
+
+	return CachedDisplayValue;
+}
+
+FText FMDFastBindingDebugLineItem::BuildDisplayValue() const
 {
 	const TTuple<const FProperty*, void*> PropertyInstance = GetPropertyInstance();
 	if (PropertyInstance.Key != nullptr && PropertyInstance.Value != nullptr)
@@ -188,14 +223,15 @@ FText FMDFastBindingDebugLineItem::GetDisplayValue() const
 				return INVTEXT("[None]");
 			}
 		}
-		else if (PropertyInstance.Key->IsA<FStructProperty>())
+		else if (const FStructProperty* StructProp = CastField<FStructProperty>(PropertyInstance.Key))
 		{
-			if (!CachedChildren.IsSet())
+			int32 NumMembers = 0;
+			for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
 			{
-				UpdateCachedChildren();
+				++NumMembers;
 			}
 
-			return FText::Format(INVTEXT("{0} {0}|plural(one=member,other=members)"), FText::AsNumber(CachedChildren.GetValue().Num()));
+			return FText::Format(INVTEXT("{0} {0}|plural(one=member,other=members)"), FText::AsNumber(NumMembers));
 		}
 		else
 		{
@@ -208,15 +244,55 @@ FText FMDFastBindingDebugLineItem::GetDisplayValue() const
 	return INVTEXT("[No Value]");
 }
 
+TOptional<uint64> FMDFastBindingDebugLineItem::GetValueKey() const
+{
+	if (const UMDFastBindingValueBase* VersionSource = GetVersionSource())
+	{
+		const TTuple<const FProperty*, void*> PropertyInstance = GetPropertyInstance();
+		const uint32 InstanceHash = HashCombine(PointerHash(PropertyInstance.Key), PointerHash(PropertyInstance.Value));
+		return (static_cast<uint64>(InstanceHash) << 32) | VersionSource->GetValueVersion();
+	}
+
+	return {};
+}
+
+bool FMDFastBindingDebugLineItem::AreCachedChildrenStale() const
+{
+	const TOptional<uint64> ValueKey = GetValueKey();
+	return ValueKey.IsSet() && ValueKey != CachedChildrenKey;
+}
+
 void FMDFastBindingDebugLineItem::UpdateCachedChildren() const
 {
 	CachedChildren = TArray<FDebugTreeItemPtr>();
+	CachedChildrenKey = GetValueKey();
+
+	int32 NumElementItems = 0;
+	auto UpdateElementItem = [this, &NumElementItems](const FProperty* ElementProp, void* ElementPtr, const TCHAR* DisplayNameFormat, int32 ElementIndex)
+	{
+		TSharedPtr<FMDFastBindingPropertyDebugLineItem>& Item = NumElementItems < CachedElementItems.Num()
+			? CachedElementItems[NumElementItems]
+			: CachedElementItems.AddDefaulted_GetRef();
+		++NumElementItems;
+
+		if (!Item.IsValid() || Item->GetItemProperty() != ElementProp)
+		{
+			const FText DisplayName = FText::Format(FTextFormat::FromString(DisplayNameFormat), FText::AsNumber(ElementIndex));
+			Item = MakeShared<FMDFastBindingPropertyDebugLineItem>(ElementProp, ElementPtr, DisplayName, GetVersionSource());
+		}
+		else if (Item->GetValuePtr() != ElementPtr)
+		{
+			Item->UpdateValuePtr(ElementPtr);
+		}
+	};
 
 	if (const FProperty* ItemProperty = GetItemProperty())
 	{
 		const TTuple<const FProperty*, void*> PropertyInstance = GetPropertyInstance();
 		const UStruct* PropertyStruct = nullptr;
 		void* PropertyValue = nullptr;
+		// Members of a referenced object can change without the value node updating
+		const UMDFastBindingValueBase* MemberVersionSource = nullptr;
 		if (const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(ItemProperty))
 		{
 			PropertyStruct = ObjectProp->PropertyClass;
@@ -229,6 +305,7 @@ void FMDFastBindingDebugLineItem::UpdateCachedChildren() const
 		{
 			PropertyStruct = StructProp->Struct;
 			PropertyValue = PropertyInstance.Value;
+			MemberVersionSource = GetVersionSource();
 		}
 		else if (ItemProperty->IsA<FInterfaceProperty>())
 		{
@@ -250,17 +327,14 @@ void FMDFastBindingDebugLineItem::UpdateCachedChildren() const
 				if (const FProperty* ChildProp = *It)
 				{
 					void* ChildValuePtr = PropertyValue != nullptr ? ChildProp->ContainerPtrToValuePtr<void>(PropertyValue) : nullptr;
-					if (!CachedPropertyItems.Contains(ChildProp->GetFName()))
+					TSharedPtr<FMDFastBindingPropertyDebugLineItem>& Item = CachedPropertyItems.FindOrAdd(ChildProp->GetFName());
+					if (!Item.IsValid())
 					{
-						CachedPropertyItems.Add(ChildProp->GetFName(), MakeShared<FMDFastBindingPropertyDebugLineItem>(ChildProp, ChildValuePtr));
+						Item = MakeShared<FMDFastBindingPropertyDebugLineItem>(ChildProp, ChildValuePtr, FText::GetEmpty(), MemberVersionSource);
 					}
-					else
+					else if (Item->GetValuePtr() != ChildValuePtr)
 					{
-						TSharedPtr<FMDFastBindingPropertyDebugLineItem> Item = StaticCastSharedPtr<FMDFastBindingPropertyDebugLineItem>(CachedPropertyItems[ChildProp->GetFName()]);
-						if (Item->GetValuePtr() != ChildValuePtr)
-						{
-							Item->UpdateValuePtr(ChildValuePtr);
-						}
+						Item->UpdateValuePtr(ChildValuePtr);
 					}
 				}
 			}
@@ -272,21 +346,7 @@ void FMDFastBindingDebugLineItem::UpdateCachedChildren() const
 				FScriptArrayHelper Helper = FScriptArrayHelper(ArrayProp, PropertyInstance.Value);
 				for (int32 i = 0; i < Helper.Num(); ++i)
 				{
-					void* ChildValuePtr = Helper.GetRawPtr(i);
-					const FText ElementDisplayName = FText::Format(INVTEXT("[{0}]"), FText::AsNumber(i));
-					const FName PropertyName = *FString::Printf(TEXT("%d"), i);
-					if (!CachedPropertyItems.Contains(PropertyName))
-					{
-						CachedPropertyItems.Add(PropertyName, MakeShared<FMDFastBindingPropertyDebugLineItem>(ArrayProp->Inner, ChildValuePtr, ElementDisplayName));
-					}
-					else
-					{
-						TSharedPtr<FMDFastBindingPropertyDebugLineItem> Item = StaticCastSharedPtr<FMDFastBindingPropertyDebugLineItem>(CachedPropertyItems[PropertyName]);
-						if (Item->GetValuePtr() != ChildValuePtr)
-						{
-							Item->UpdateValuePtr(ChildValuePtr);
-						}
-					}
+					UpdateElementItem(ArrayProp->Inner, Helper.GetRawPtr(i), TEXT("[{0}]"), i);
 				}
 			}
 		}
@@ -297,21 +357,7 @@ void FMDFastBindingDebugLineItem::UpdateCachedChildren() const
 				FScriptSetHelper Helper = FScriptSetHelper(SetProp, PropertyInstance.Value);
 				for (int32 i = 0; i < Helper.Num(); ++i)
 				{
-					void* ChildValuePtr = Helper.GetElementPtr(i);
-					const FText ElementDisplayName = FText::Format(INVTEXT("[{0}]"), FText::AsNumber(i));
-					const FName PropertyName = *FString::Printf(TEXT("%d"), i);
-					if (!CachedPropertyItems.Contains(PropertyName))
-					{
-						CachedPropertyItems.Add(PropertyName, MakeShared<FMDFastBindingPropertyDebugLineItem>(SetProp->ElementProp, ChildValuePtr, ElementDisplayName));
-					}
-					else
-					{
-						TSharedPtr<FMDFastBindingPropertyDebugLineItem> Item = StaticCastSharedPtr<FMDFastBindingPropertyDebugLineItem>(CachedPropertyItems[PropertyName]);
-						if (Item->GetValuePtr() != ChildValuePtr)
-						{
-							Item->UpdateValuePtr(ChildValuePtr);
-						}
-					}
+					UpdateElementItem(SetProp->ElementProp, Helper.GetElementPtr(i), TEXT("[{0}]"), i);
 				}
 			}
 		}
@@ -322,45 +368,23 @@ void FMDFastBindingDebugLineItem::UpdateCachedChildren() const
 				FScriptMapHelper Helper = FScriptMapHelper(MapProp, PropertyInstance.Value);
 				for (int32 i = 0; i < Helper.Num(); ++i)
 				{
-					// Key
-					void* ChildKeyPtr = Helper.GetKeyPtr(i);
-					const FText KeyDisplayName = FText::Format(INVTEXT("Key[{0}]"), FText::AsNumber(i));
-					const FName KeyPropertyName = *FString::Printf(TEXT("Key[%d]"), i);
-					if (!CachedPropertyItems.Contains(KeyPropertyName))
-					{
-						CachedPropertyItems.Add(KeyPropertyName, MakeShared<FMDFastBindingPropertyDebugLineItem>(MapProp->KeyProp, ChildKeyPtr, KeyDisplayName));
-					}
-					else
-					{
-						TSharedPtr<FMDFastBindingPropertyDebugLineItem> Item = StaticCastSharedPtr<FMDFastBindingPropertyDebugLineItem>(CachedPropertyItems[KeyPropertyName]);
-						if (Item->GetValuePtr() != ChildKeyPtr)
-						{
-							Item->UpdateValuePtr(ChildKeyPtr);
-						}
-					}
-
-					// Value
-					void* ChildValuePtr = Helper.GetValuePtr(i);
-					const FText ValueDisplayName = FText::Format(INVTEXT("Value[{0}]"), FText::AsNumber(i));
-					const FName ValuePropertyName = *FString::Printf(TEXT("Value[%d]"), i);
-					if (!CachedPropertyItems.Contains(ValuePropertyName))
-					{
-						CachedPropertyItems.Add(ValuePropertyName, MakeShared<FMDFastBindingPropertyDebugLineItem>(MapProp->ValueProp, ChildValuePtr, ValueDisplayName));
-					}
-					else
-					{
-						TSharedPtr<FMDFastBindingPropertyDebugLineItem> Item = StaticCastSharedPtr<FMDFastBindingPropertyDebugLineItem>(CachedPropertyItems[ValuePropertyName]);
-						if (Item->GetValuePtr() != ChildValuePtr)
-						{
-							Item->UpdateValuePtr(ChildValuePtr);
-						}
-					}
+					UpdateElementItem(MapProp->KeyProp, Helper.GetKeyPtr(i), TEXT("Key[{0}]"), i);
+					UpdateElementItem(MapProp->ValueProp, Helper.GetValuePtr(i), TEXT("Value[{0}]"), i);
 				}
 			}
 		}
 	}
 
-	CachedPropertyItems.GenerateValueArray(CachedChildren.GetValue());
+	// Drop items for elements that were removed so they don't keep pointing into freed memory
+	CachedElementItems.SetNum(NumElementItems);
+
+	CachedChildren.GetValue().Reserve(CachedPropertyItems.Num() + CachedElementItems.Num());
+	for (const TPair<FName, TSharedPtr<FMDFastBindingPropertyDebugLineItem>>& Pair : CachedPropertyItems)
+	{
+		CachedChildren.GetValue().Add(Pair.Value);
+	}
+
+	CachedChildren.GetValue().Append(CachedElementItems);
 }
 
 void FMDFastBindingItemDebugLineItem::RefreshDebugObject(UMDFastBindingObject* DebugObject)
@@ -406,6 +430,17 @@ TTuple<const FProperty*, void*> FMDFastBindingItemDebugLineItem::GetPropertyInst
 	return {};
 }
 
+const UMDFastBindingValueBase* FMDFastBindingItemDebugLineItem::GetVersionSource() const
+{
+	// Items without a value node use their default value, which doesn't change at runtime but isn't versioned either
+	if (const FMDFastBindingItem* BindingItem = GetBindingItem())
+	{
+		return BindingItem->Value;
+	}
+
+	return nullptr;
+}
+
 #if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 4
 UObject* FMDFastBindingItemDebugLineItem::GetParentObject() const
 #else
@@ -472,6 +507,11 @@ TTuple<const FProperty*, void*> FMDFastBindingPropertyDebugLineItem::GetProperty
 	return TTuple<const FProperty*, void*>{ PropertyPtr.Get(), ValuePtr };
 }
 
+const UMDFastBindingValueBase* FMDFastBindingPropertyDebugLineItem::GetVersionSource() const
+{
+	return VersionSource.Get();
+}
+
 void SMDFastBindingPinValueInspector::SetReferences(UEdGraphPin* Pin, UMDFastBindingObject* DebugObject)
 {
 	PinName = Pin->PinName;
@@ -510,8 +550,7 @@ void SMDFastBindingWatchList::PopulateTreeView()
 	bIsDebugging = DebugBinding.IsValid();
 	if (const UMDFastBindingInstance* Binding = bIsDebugging ? DebugBinding.Get() : CDOBinding.Get())
 	{
-		const TArray<UMDFastBindingObject*> Objects = Binding->GatherAllBindingObjects();
-		for (UMDFastBindingObject* Object : Objects)
+		for (UMDFastBindingObject* Object : Binding->GetAllBindingObjects())
 		{
 			if (UMDFastBindingDebugPersistentData::Get().IsNodeBeingWatched(Object->BindingObjectIdentifier))
 			{
@@ -3,6 +3,7 @@
 #include "Graph/MDFastBindingConnectionDrawingPolicy.h"
 
 #include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "Debug/MDFastBindingDebugPersistentData.h"
 #include "Graph/MDFastBindingGraph.h"
 #include "Graph/MDFastBindingGraphNode.h"
 #include "MDFastBindingInstance.h"
@@ -31,6 +32,15 @@ void FMDFastBindingConnectionDrawingPolicy::DetermineWiringStyle(UEdGraphPin* Ou
 				DetermineStyleOfExecWire(Params.WireThickness, Params.WireColor, Params.bDrawBubbles, *PinTime);
 			}
 		}
+
+		// Wires carry the output node's value, so they take on its heat
+		const UMDFastBindingGraphNode* OutputBindingNode = Cast<UMDFastBindingGraphNode>(OutputNode);
+		if (OutputBindingNode != nullptr && OutputBindingNode->IsShowingHeatMap())
+		{
+			const float HeatFraction = OutputBindingNode->GetHeatFraction();
+			Params.WireColor = OutputBindingNode->GetHeatColor();
+			Params.WireThickness = FMath::Lerp(1.5f, 5.f, HeatFraction);
+		}
 	}
 }
 
@@ -12,6 +12,42 @@
 #include "MDFastBindingObject.h"
 #include "UObject/Package.h"
 
+namespace MDFastBindingGraph_Private
+{
+	bool DoPinsMatch(const TArray<UEdGraphPin*>& PinsA, const TArray<UEdGraphPin*>& PinsB)
+	{
+		if (PinsA.Num() != PinsB.Num())
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < PinsA.Num(); ++i)
+		{
+			const UEdGraphPin* PinA = PinsA[i];
+			const UEdGraphPin* PinB = PinsB[i];
+			if (PinA->PinName != PinB->PinName || PinA->Direction != PinB->Direction || PinA->PinType != PinB->PinType
+				|| PinA->DefaultValue != PinB->DefaultValue || PinA->DefaultObject != PinB->DefaultObject
+				|| !PinA->DefaultTextValue.IdenticalTo(PinB->DefaultTextValue) || !PinA->PinFriendlyName.IdenticalTo(PinB->PinFriendlyName)
+				|| PinA->PinToolTip != PinB->PinToolTip)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void DestroyPins(TArray<UEdGraphPin*>& Pins)
+	{
+		for (UEdGraphPin* Pin : Pins)
+		{
+			Pin->MarkAsGarbage();
+		}
+
+		Pins.Reset();
+	}
+}
+
 #if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
 void UMDFastBindingGraph::AddNode(UEdGraphNode* NodeToAdd, bool bUserAction, bool bSelectNewNode)
 {
@@ -39,10 +75,18 @@ void UMDFastBindingGraph::RefreshGraph()
 
 void UMDFastBindingGraph::SetBinding(UMDFastBindingInstance* InBinding)
 {
+	const TArray<UMDFastBindingObject*> Objects = IsValid(InBinding) ? InBinding->GatherAllBindingObjects() : TArray<UMDFastBindingObject*>{};
+
+	// Rebuilding every node (and every node widget) is slow for large bindings, so refreshing the same binding only updates what changed
+	if (InBinding != nullptr && InBinding == Binding.Get() && !Nodes.IsEmpty() && !Objects.IsEmpty())
+	{
+		UpdateNodes(Objects);
+		return;
+	}
+
 	Nodes.Empty();
 	Binding = InBinding;
 
-	const TArray<UMDFastBindingObject*> Objects = IsValid(InBinding) ? InBinding->GatherAllBindingObjects() : TArray<UMDFastBindingObject*>{};
 	if (Objects.IsEmpty())
 	{
 		NotifyGraphChanged(FEdGraphEditAction(EEdGraphActionType::GRAPHACTION_Default, this, nullptr, false));
@@ -51,12 +95,91 @@ void UMDFastBindingGraph::SetBinding(UMDFastBindingInstance* InBinding)
 
 	for (UMDFastBindingObject* Object : Objects)
 	{
-		UMDFastBindingGraphNode* NewNode = Cast<UMDFastBindingGraphNode>(CreateNode(UMDFastBindingGraphNode::StaticClass(), false));
-		NewNode->SetBindingObject(Object);
-		NewNode->AllocateDefaultPins();
+		CreateBindingNode(Object);
+	}
+
+	LinkPins();
+}
+
+UMDFastBindingGraphNode* UMDFastBindingGraph::CreateBindingNode(UMDFastBindingObject* Object)
+{
+	UMDFastBindingGraphNode* NewNode = Cast<UMDFastBindingGraphNode>(CreateNode(UMDFastBindingGraphNode::StaticClass(), false));
+	NewNode->SetBindingObject(Object);
+	NewNode->AllocateDefaultPins();
+	NewNode->SetBindingBeingDebugged(BindingBeingDebugged.Get());
+	return NewNode;
+}
+
+void UMDFastBindingGraph::UpdateNodes(const TArray<UMDFastBindingObject*>& Objects)
+{
+	TMap<FGuid, UMDFastBindingGraphNode*> ExistingNodes;
+	TArray<UMDFastBindingGraphNode*> RemovedNodes;
+	for (UEdGraphNode* Node : Nodes)
+	{
+		if (UMDFastBindingGraphNode* BindingNode = Cast<UMDFastBindingGraphNode>(Node))
+		{
+			if (ExistingNodes.Contains(BindingNode->NodeGuid))
+			{
+				RemovedNodes.Add(BindingNode);
+			}
+			else
+			{
+				ExistingNodes.Add(BindingNode->NodeGuid, BindingNode);
+			}
+
+			// Links are cheap to rebuild, so clear them all rather than diffing them
+			for (UEdGraphPin* Pin : BindingNode->Pins)
+			{
+				Pin->LinkedTo.Reset();
+			}
+		}
+	}
+
+	for (UMDFastBindingObject* Object : Objects)
+	{
+		UMDFastBindingGraphNode* BindingNode = nullptr;
+		if (!ExistingNodes.RemoveAndCopyValue(Object->BindingObjectIdentifier, BindingNode))
+		{
+			CreateBindingNode(Object);
+			continue;
+		}
+
+		// Picks up position and comment changes, and the new object if it was replaced (eg. by undo)
+		BindingNode->SetBindingObject(Object);
+
+		TArray<UEdGraphPin*> OldPins = MoveTemp(BindingNode->Pins);
+		BindingNode->Pins.Reset();
+		BindingNode->AllocateDefaultPins();
+		if (MDFastBindingGraph_Private::DoPinsMatch(OldPins, BindingNode->Pins))
+		{
+			// Keep the old pins so the node's widget doesn't need rebuilding
+			MDFastBindingGraph_Private::DestroyPins(BindingNode->Pins);
+			BindingNode->Pins = MoveTemp(OldPins);
+		}
+		else
+		{
+			MDFastBindingGraph_Private::DestroyPins(OldPins);
+			NotifyNodeChanged(BindingNode);
+		}
+	}
+
+	// Whatever is left no longer has a binding object
+	for (const TPair<FGuid, UMDFastBindingGraphNode*>& Pair : ExistingNodes)
+	{
+		RemovedNodes.Add(Pair.Value);
+	}
+
+	for (UMDFastBindingGraphNode* RemovedNode : RemovedNodes)
+	{
+		Nodes.Remove(RemovedNode);
+		NotifyGraphChanged(FEdGraphEditAction(EEdGraphActionType::GRAPHACTION_RemoveNode, this, RemovedNode, false));
 	}
 
-	// Form pin connections
+	LinkPins();
+}
+
+void UMDFastBindingGraph::LinkPins()
+{
 	for (UEdGraphNode* Node : Nodes)
 	{
 		if (const UMDFastBindingGraphNode* BindingNode = Cast<UMDFastBindingGraphNode>(Node))
@@ -115,6 +238,20 @@ UMDFastBindingGraphNode* UMDFastBindingGraph::FindNodeWithBindingObject(UMDFastB
 	return nullptr;
 }
 
+double UMDFastBindingGraph::GetMaxNodeMicrosecondsPerFrame() const
+{
+	double MaxMicroseconds = 0.0;
+	for (const UEdGraphNode* Node : Nodes)
+	{
+		if (const UMDFastBindingGraphNode* BindingNode = Cast<UMDFastBindingGraphNode>(Node))
+		{
+			MaxMicroseconds = FMath::Max(MaxMicroseconds, BindingNode->GetHeat().MicrosecondsPerFrame);
+		}
+	}
+
+	return MaxMicroseconds;
+}
+
 void UMDFastBindingGraph::SelectNodeWithBindingObject(UMDFastBindingObject* InObject)
 {
 	if (UMDFastBindingGraphNode* NodeWithObject = FindNodeWithBindingObject(InObject))
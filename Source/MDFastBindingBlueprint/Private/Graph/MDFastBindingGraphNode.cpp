@@ -6,6 +6,7 @@
 #include "BindingDestinations/MDFastBindingDestination_Function.h"
 #include "BindingValues/MDFastBindingValueBase.h"
 #include "BindingValues/MDFastBindingValue_Function.h"
+#include "Debug/MDFastBindingDebugPersistentData.h"
 #include "EdGraphSchema_K2.h"
 #include "Graph/MDFastBindingGraph.h"
 #include "Graph/SMDFastBindingGraphNodeWidget.h"
@@ -19,6 +20,14 @@
 
 #define LOCTEXT_NAMESPACE "MDFastBindingGraphNode"
 
+namespace MDFastBindingGraphNode_Private
+{
+	constexpr double HeatSampleInterval = 0.5;
+
+	const FLinearColor ColdColor = FLinearColor(0.1f, 0.6f, 0.1f);
+	const FLinearColor HotColor = FLinearColor(0.9f, 0.05f, 0.02f);
+}
+
 const FName UMDFastBindingGraphNode::OutputPinName = TEXT("Output");
 
 UMDFastBindingGraphNode::UMDFastBindingGraphNode()
@@ -58,6 +67,73 @@ UMDFastBindingObject* UMDFastBindingGraphNode::GetBindingObjectBeingDebugged() c
 	return nullptr;
 }
 
+bool UMDFastBindingGraphNode::IsShowingHeatMap() const
+{
+	return UMDFastBindingDebugPersistentData::Get().IsHeatMapEnabled() && GetBindingObjectBeingDebugged() != nullptr;
+}
+
+void UMDFastBindingGraphNode::UpdateHeatSample(double CurrentTime)
+{
+	UMDFastBindingObject* DebugObject = GetBindingObjectBeingDebugged();
+	if (DebugObject != LastSampledObject.Get())
+	{
+		// Counters from a different object can't be compared, start over
+		Heat = {};
+		LastSampledObject = DebugObject;
+		LastSampledStats = DebugObject != nullptr ? DebugObject->NodeStats : FMDFastBindingNodeStats();
+		LastSampleTime = CurrentTime;
+		LastSampleFrame = GFrameCounter;
+		return;
+	}
+
+	if (DebugObject == nullptr || CurrentTime - LastSampleTime < MDFastBindingGraphNode_Private::HeatSampleInterval)
+	{
+		return;
+	}
+
+	const FMDFastBindingNodeStats& Stats = DebugObject->NodeStats;
+	const uint64 NumEvaluations = Stats.NumEvaluations - LastSampledStats.NumEvaluations;
+	const uint64 NumFrames = GFrameCounter - LastSampleFrame;
+
+	Heat.EvaluationsPerSecond = NumEvaluations / (CurrentTime - LastSampleTime);
+	Heat.MicrosecondsPerFrame = NumFrames > 0
+		? FPlatformTime::GetSecondsPerCycle64() * (Stats.ExclusiveCycles - LastSampledStats.ExclusiveCycles) * 1000000.0 / NumFrames
+		: 0.0;
+
+	if (DebugObject->IsA<UMDFastBindingValueBase>())
+	{
+		Heat.ChangedRatio = NumEvaluations > 0 ? static_cast<double>(Stats.NumChanges - LastSampledStats.NumChanges) / NumEvaluations : 0.0;
+	}
+	else
+	{
+		Heat.ChangedRatio = -1.0;
+	}
+
+	LastSampledStats = Stats;
+	LastSampleTime = CurrentTime;
+	LastSampleFrame = GFrameCounter;
+}
+
+float UMDFastBindingGraphNode::GetHeatFraction() const
+{
+	if (const UMDFastBindingGraph* MDGraph = Cast<UMDFastBindingGraph>(GetGraph()))
+	{
+		const double MaxMicroseconds = MDGraph->GetMaxNodeMicrosecondsPerFrame();
+		if (MaxMicroseconds > UE_DOUBLE_SMALL_NUMBER)
+		{
+			return static_cast<float>(FMath::Clamp(Heat.MicrosecondsPerFrame / MaxMicroseconds, 0.0, 1.0));
+		}
+	}
+
+	return 0.f;
+}
+
+FLinearColor UMDFastBindingGraphNode::GetHeatColor() const
+{
+	using namespace MDFastBindingGraphNode_Private;
+	return FLinearColor::LerpUsingHSV(ColdColor, HotColor, GetHeatFraction());
+}
+
 UMDFastBindingGraphNode* UMDFastBindingGraphNode::GetLinkedOutputNode() const
 {
 	const UEdGraphPin* OutputPin = FindPin(OutputPinName);
@@ -263,6 +339,11 @@ void UMDFastBindingGraphNode::OnCommentBubbleToggled(bool bInCommentBubbleVisibl
 
 FLinearColor UMDFastBindingGraphNode::GetNodeTitleColor() const
 {
+	if (IsShowingHeatMap())
+	{
+		return GetHeatColor();
+	}
+
 	const ISlateStyle* FastBindingStyle = FSlateStyleRegistry::FindSlateStyle(TEXT("MDFastBindingEditorStyle"));
 	if (FastBindingStyle == nullptr)
 	{
@@ -295,6 +376,22 @@ FText UMDFastBindingGraphNode::GetTooltipText() const
 
 	if (UMDFastBindingObject* Object = BindingObject.Get())
 	{
+		if (IsShowingHeatMap())
+		{
+			FNumberFormattingOptions Options;
+			Options.SetMaximumFractionalDigits(2);
+
+			const FText ChangedText = Heat.ChangedRatio >= 0.0
+				? FText::AsPercent(Heat.ChangedRatio)
+				: LOCTEXT("HeatNotApplicable", "n/a");
+
+			return FText::Format(LOCTEXT("HeatMapToolTipFormat", "{0}\n\nTime per frame: {1} us\nEvaluations per second: {2}\nChanged: {3} of evaluations")
+				, Object->GetToolTipText()
+				, FText::AsNumber(Heat.MicrosecondsPerFrame, &Options)
+				, FText::AsNumber(Heat.EvaluationsPerSecond, &Options)
+				, ChangedText);
+		}
+
 		return Object->GetToolTipText();
 	}
 
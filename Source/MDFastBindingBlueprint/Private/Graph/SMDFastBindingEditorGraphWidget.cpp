@@ -24,7 +24,10 @@
 #include "SequencerSettings.h"
 #include "UObject/StrongObjectPtr.h"
 #include "UObject/UObjectIterator.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/SOverlay.h"
+#include "Widgets/Text/STextBlock.h"
 
 #define LOCTEXT_NAMESPACE "SMDFastBindingEditorGraphWidget"
 
@@ -47,6 +50,9 @@ void SMDFastBindingEditorGraphWidget::Construct(const FArguments& InArgs, UBluep
 
 	RegisterCommands();
 
+	// Node stats are only gathered while the heat map is shown
+	FMDFastBindingNodeStats::SetRecording(UMDFastBindingDebugPersistentData::Get().IsHeatMapEnabled());
+
 	GraphEditor = SNew(SGraphEditor)
 		.GraphToEdit(GraphObj)
 		.AdditionalCommands(GraphEditorCommands)
@@ -54,7 +60,33 @@ void SMDFastBindingEditorGraphWidget::Construct(const FArguments& InArgs, UBluep
 
 	ChildSlot
 	[
-		GraphEditor.ToSharedRef()
+		SNew(SOverlay)
+		+SOverlay::Slot()
+		[
+			GraphEditor.ToSharedRef()
+		]
+		+SOverlay::Slot()
+		.HAlign(HAlign_Right)
+		.VAlign(VAlign_Top)
+		.Padding(8.f)
+		[
+			SNew(SCheckBox)
+			.Style(FAppStyle::Get(), "ToggleButtonCheckbox")
+			.ToolTipText(LOCTEXT("HeatMapToggleTooltip", "Color nodes and wires by the time they take in the widget being debugged. Hover a node to see its time per frame, evaluations per second and how often its value changes."))
+			.IsChecked_Lambda([]()
+			{
+				return UMDFastBindingDebugPersistentData::Get().IsHeatMapEnabled() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			})
+			.OnCheckStateChanged_Lambda([](ECheckBoxState NewState)
+			{
+				UMDFastBindingDebugPersistentData::Get().SetHeatMapEnabled(NewState == ECheckBoxState::Checked);
+			})
+			[
+				SNew(STextBlock)
+				.Margin(FMargin(4.f, 2.f))
+				.Text(LOCTEXT("HeatMapToggleLabel", "Heat Map"))
+			]
+		]
 	];
 }
 
@@ -474,6 +506,7 @@ void SMDFastBindingEditorGraphWidget::PasteNodes() const
 		if (BindingObject != nullptr)
 		{
 			BindingObject->BindingObjectIdentifier = FGuid::NewGuid();
+			BindingObject->MarkBindingStructureChanged();
 		}
 	}
 
@@ -3,6 +3,7 @@
 #include "Graph/SMDFastBindingGraphNodeWidget.h"
 
 #include "BlueprintEditor.h"
+#include "Debug/MDFastBindingDebugPersistentData.h"
 #include "Debug/MDFastBindingEditorDebug.h"
 #include "GraphEditorSettings.h"
 #include "Graph/MDFastBindingGraphNode.h"
@@ -151,6 +152,14 @@ void SMDFastBindingGraphNodeWidget::Tick(const FGeometry& AllottedGeometry, cons
 	SGraphNode::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 
 	UpdateDebugTooltip(InCurrentTime);
+
+	if (UMDFastBindingDebugPersistentData::Get().IsHeatMapEnabled())
+	{
+		if (UMDFastBindingGraphNode* Node = GetGraphNode())
+		{
+			Node->UpdateHeatSample(InCurrentTime);
+		}
+	}
 }
 
 void SMDFastBindingGraphNodeWidget::GetOverlayBrushes(bool bSelected, const FVector2D WidgetSize, TArray<FOverlayBrushInfo>& Brushes) const
@@ -7,6 +7,7 @@
 #include "MDFastBindingWidgetBlueprintExtension.generated.h"
 
 class UMDFastBindingContainer;
+class UMDFastBindingInstance;
 
 /*
  * Holds the design time BindingContainer and compiles it to a MDFastBindingWidgetClassExtension
@@ -27,6 +28,8 @@ public:
 
 	FSimpleMulticastDelegate OnBindingsUpdatedExternally;
 
+	virtual void BeginDestroy() override;
+
 #if WITH_EDITORONLY_DATA
 	virtual void GetAllGraphs(TArray<UEdGraph*>& Graphs) const
 #if defined(WITH_FASTBINDING_DIFFS) && WITH_FASTBINDING_DIFFS
@@ -45,10 +48,15 @@ protected:
 	TObjectPtr<UMDFastBindingContainer> BindingContainer = nullptr;
 
 private:
-	// Temporary graphs that are pinned for use with in the diff tool
+	// Temporary graphs that are pinned for use with in the diff tool, updated on compile
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<class UMDFastBindingGraph>> PinnedGraphs;
 	void PopulatePinnedGraphs();
 
+	// Bindings whose objects were modified since their pinned graph was last updated, only their graphs are refreshed on compile
+	void OnObjectModified(UObject* Object);
+	TSet<TWeakObjectPtr<UMDFastBindingInstance>> ModifiedBindings;
+	FDelegateHandle ObjectModifiedHandle;
+
 	FWidgetBlueprintCompilerContext* CompilerContext = nullptr;
 };
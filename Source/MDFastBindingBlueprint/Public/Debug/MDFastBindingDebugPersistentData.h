@@ -36,8 +36,15 @@ public:
 
 	FSimpleMulticastDelegate OnWatchListChanged;
 
+	// The heat map colors graph nodes and wires by how much time they take in the binding being debugged
+	bool IsHeatMapEnabled() const { return bIsHeatMapEnabled; }
+	void SetHeatMapEnabled(bool bInIsEnabled);
+
 protected:
 	// Map binding node GUID to list of pins being watched
 	UPROPERTY(Config)
 	TMap<FGuid, FMDFastBindingEditorPinWatchList> NodePinWatchList;
+
+	UPROPERTY(Config)
+	bool bIsHeatMapEnabled = false;
 };
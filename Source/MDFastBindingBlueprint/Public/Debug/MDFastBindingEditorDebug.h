@@ -8,8 +8,10 @@
 
 
 struct FMDFastBindingItem;
+class FMDFastBindingPropertyDebugLineItem;
 class UMDFastBindingInstance;
 class UMDFastBindingObject;
+class UMDFastBindingValueBase;
 
 
 class FMDFastBindingDebugLineItemBase : public FDebugLineItem
@@ -26,6 +28,9 @@ public:
 protected:
 	using FDebugLineItem::FDebugLineItem;
 
+	// Children are rebuilt when gathered if they're stale
+	virtual bool AreCachedChildrenStale() const { return false; }
+
 	mutable TOptional<TArray<FDebugTreeItemPtr>> CachedChildren;
 };
 
@@ -88,6 +93,8 @@ public:
 
 	virtual TSharedRef<SWidget> GenerateValueWidget(TSharedPtr<FString> InSearchString) override;
 
+	virtual bool HasChildren() const override;
+
 protected:
 	FMDFastBindingDebugLineItem()
 		: FMDFastBindingDebugLineItemBase(EDebugLineType::DLT_Watch)
@@ -111,14 +118,30 @@ protected:
 
 	virtual TTuple<const FProperty*, void*> GetPropertyInstance() const = 0;
 
+	// The value node whose version changes when this item's value does,
+	// null if changes can't be tracked (eg. members of an object the value points to)
+	virtual const UMDFastBindingValueBase* GetVersionSource() const { return nullptr; }
+
 	virtual const FProperty* GetItemProperty() const;
 
 	virtual FText GetDisplayValue() const;
 
+	virtual bool AreCachedChildrenStale() const override;
 	virtual void UpdateCachedChildren() const override;
 
 private:
-	mutable TMap<FName, FDebugTreeItemPtr> CachedPropertyItems;
+	FText BuildDisplayValue() const;
+
+	// Identifies the value that the display text and children were built from, unset if the value isn't tracked
+	TOptional<uint64> GetValueKey() const;
+
+	mutable TMap<FName, TSharedPtr<FMDFastBindingPropertyDebugLineItem>> CachedPropertyItems;
+	// Array and set elements by index, map keys and values interleaved
+	mutable TArray<TSharedPtr<FMDFastBindingPropertyDebugLineItem>> CachedElementItems;
+
+	mutable FText CachedDisplayValue;
+	mutable TOptional<uint64> CachedDisplayValueKey;
+	mutable TOptional<uint64> CachedChildrenKey;
 };
 
 
@@ -152,6 +175,8 @@ protected:
 
 	virtual TTuple<const FProperty*, void*> GetPropertyInstance() const override;
 
+	virtual const UMDFastBindingValueBase* GetVersionSource() const override;
+
 #if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 4
 	virtual UObject* GetParentObject() const override;
 #else
@@ -169,10 +194,11 @@ private:
 class FMDFastBindingPropertyDebugLineItem : public FMDFastBindingDebugLineItem
 {
 public:
-	FMDFastBindingPropertyDebugLineItem(const FProperty* Property, void* InValuePtr, const FText& InDisplayNameOverride = FText::GetEmpty())
+	FMDFastBindingPropertyDebugLineItem(const FProperty* Property, void* InValuePtr, const FText& InDisplayNameOverride = FText::GetEmpty(), const UMDFastBindingValueBase* InVersionSource = nullptr)
 		: PropertyPtr(Property)
 		, ValuePtr(InValuePtr)
 		, DisplayNameOverride(InDisplayNameOverride)
+		, VersionSource(InVersionSource)
 	{
 	}
 
@@ -198,15 +224,18 @@ public:
 protected:
 	virtual FDebugLineItem* Duplicate() const override
 	{
-		return new FMDFastBindingPropertyDebugLineItem(PropertyPtr.Get(), ValuePtr, DisplayNameOverride);
+		return new FMDFastBindingPropertyDebugLineItem(PropertyPtr.Get(), ValuePtr, DisplayNameOverride, GetVersionSource());
 	}
 
 	virtual TTuple<const FProperty*, void*> GetPropertyInstance() const override;
 
+	virtual const UMDFastBindingValueBase* GetVersionSource() const override;
+
 private:
 	TWeakFieldPtr<const FProperty> PropertyPtr;
 	void* ValuePtr = nullptr;
 	FText DisplayNameOverride;
+	TWeakObjectPtr<const UMDFastBindingValueBase> VersionSource;
 };
 
 
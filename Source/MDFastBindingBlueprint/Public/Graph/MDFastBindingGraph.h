@@ -26,8 +26,10 @@ public:
 
 	void SetGraphWidget(TSharedRef<SMDFastBindingEditorGraphWidget> InGraphWidget);
 
+	// Updates the graph to match its binding, only touching nodes whose binding objects were added, removed or changed pins
 	void RefreshGraph();
 
+	// Setting the binding that's already shown refreshes the graph incrementally
 	void SetBinding(UMDFastBindingInstance* InBinding);
 	UMDFastBindingInstance* GetBinding() const { return Binding.Get(); }
 
@@ -35,6 +37,9 @@ public:
 	UMDFastBindingInstance* GetBindingBeingDebugged() const { return BindingBeingDebugged.Get(); }
 
 	UMDFastBindingGraphNode* FindNodeWithBindingObject(UMDFastBindingObject* InObject) const;
+
+	// The heat map is relative to the most expensive node in the graph
+	double GetMaxNodeMicrosecondsPerFrame() const;
 	void SelectNodeWithBindingObject(UMDFastBindingObject* InObject);
 
 	void ClearSelection();
@@ -42,6 +47,10 @@ public:
 	UBlueprint* GetBlueprint() const;
 
 private:
+	UMDFastBindingGraphNode* CreateBindingNode(UMDFastBindingObject* Object);
+	void UpdateNodes(const TArray<UMDFastBindingObject*>& Objects);
+	void LinkPins();
+
 	TWeakObjectPtr<UMDFastBindingInstance> Binding;
 	TWeakObjectPtr<UMDFastBindingInstance> BindingBeingDebugged;
 
@@ -3,11 +3,21 @@
 #pragma once
 
 #include "EdGraph/EdGraphNode.h"
+#include "MDFastBindingNodeStats.h"
 #include "MDFastBindingGraphNode.generated.h"
 
 class UMDFastBindingInstance;
 class UMDFastBindingObject;
 
+// Rates measured from the binding object being debugged, shown by the heat map
+struct FMDFastBindingNodeHeat
+{
+	double MicrosecondsPerFrame = 0.0;
+	double EvaluationsPerSecond = 0.0;
+	// Fraction of evaluations that changed the value, negative for nodes that don't have a value (destinations)
+	double ChangedRatio = -1.0;
+};
+
 /**
  *
  */
@@ -31,6 +41,13 @@ public:
 
 	UMDFastBindingGraphNode* GetLinkedOutputNode() const;
 
+	bool IsShowingHeatMap() const;
+	void UpdateHeatSample(double CurrentTime);
+	const FMDFastBindingNodeHeat& GetHeat() const { return Heat; }
+	// How hot this node is relative to the hottest node in the graph, from 0 to 1
+	float GetHeatFraction() const;
+	FLinearColor GetHeatColor() const;
+
 	void ClearConnection(const FName& PinName);
 
 	void OnMoved();
@@ -76,4 +93,10 @@ private:
 
 	UPROPERTY()
 	TObjectPtr<UMDFastBindingObject> CopiedObject = nullptr;
+
+	FMDFastBindingNodeHeat Heat;
+	FMDFastBindingNodeStats LastSampledStats;
+	TWeakObjectPtr<UMDFastBindingObject> LastSampledObject;
+	double LastSampleTime = 0.0;
+	uint64 LastSampleFrame = 0;
 };
@@ -37,11 +37,13 @@ public class MDFastBindingEditor : ModuleRules
 			new string[]
 			{
 				"ApplicationCore",
+				"AssetRegistry",
 				"BlueprintGraph",
 				"CoreUObject",
 				"EditorStyle",
 				"Engine",
 				"InputCore",
+				"Json",
 				"Kismet",
 				"MDFastBindingBlueprint",
 				"Projects",
@@ -0,0 +1,340 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "Commandlets/MDFastBindingAuditCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "BindingValues/MDFastBindingValueBase.h"
+#include "BindingValues/MDFastBindingValue_FieldNotify.h"
+#include "BindingValues/MDFastBindingValue_Function.h"
+#include "BindingValues/MDFastBindingValue_Property.h"
+#include "BlueprintExtension/MDFastBindingWidgetBlueprintExtension.h"
+#include "Dom/JsonObject.h"
+#include "MDFastBindingContainer.h"
+#include "MDFastBindingCostEstimate.h"
+#include "MDFastBindingInstance.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Serialization/JsonSerializer.h"
+#include "WidgetBlueprint.h"
+
+#if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
+#include "INotifyFieldValueChanged.h"
+#else
+#include "FieldNotification/IFieldValueChanged.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMDFastBindingAudit, Log, All);
+
+namespace MDFastBindingAuditCommandlet_Private
+{
+	// Loading ~1000s of widget blueprints will run out of memory without collecting along the way
+	constexpr int32 NumBlueprintsPerGC = 50;
+
+	const FString SuggestFieldNotify = TEXT("FieldNotify");
+	const FString SuggestIfUpdatesNeeded = TEXT("IfUpdatesNeeded");
+
+	struct FAuditTotals
+	{
+		int32 NumBlueprints = 0;
+		int32 NumBindings = 0;
+		int32 NumTickingBindings = 0;
+		int32 NumInvalidBindings = 0;
+		int32 NumSuggestions = 0;
+	};
+
+	bool IsFieldNotifyField(const FFieldVariant& Field)
+	{
+		// Blueprint variables use the meta data to mark field notify
+		const FProperty* Prop = CastField<FProperty>(Field.ToField());
+		if (Prop != nullptr && !Prop->IsNative())
+		{
+			return Prop->HasMetaData(TEXT("FieldNotify"));
+		}
+
+		const UClass* OwnerClass = Field.GetOwnerClass();
+		if (IsValid(OwnerClass))
+		{
+			if (const INotifyFieldValueChanged* FieldNotify = Cast<INotifyFieldValueChanged>(OwnerClass->GetDefaultObject()))
+			{
+				return FieldNotify->GetFieldNotificationDescriptor().GetField(OwnerClass, Field.GetFName()).IsValid();
+			}
+		}
+
+		return false;
+	}
+
+	// Same rules as UMDFastBindingInstance::IsBindingPerformant, for a single node
+	bool DoesNodeTick(const UMDFastBindingObject* Node)
+	{
+		if (Node == nullptr || Node->GetUpdateType() == EMDFastBindingUpdateType::Once)
+		{
+			return false;
+		}
+
+		if (Node->GetUpdateType() == EMDFastBindingUpdateType::Always)
+		{
+			return true;
+		}
+
+		for (const FMDFastBindingItem& Item : Node->GetBindingItems())
+		{
+			if (DoesNodeTick(Item.Value))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Returns the update type an `Always` node could use instead, or an empty string if it needs to be `Always`
+	FString GetUpdateTypeSuggestion(UMDFastBindingObject* Node)
+	{
+		if (UMDFastBindingValue_Property* PropertyValue = Cast<UMDFastBindingValue_Property>(Node))
+		{
+			// Property and getter reads only see changes by polling, unless the field broadcasts them
+			const TArray<FFieldVariant> FieldPath = PropertyValue->GetFieldPath();
+			if (!Node->IsA<UMDFastBindingValue_FieldNotify>() && FieldPath.Num() > 0 && IsFieldNotifyField(FieldPath.Last()))
+			{
+				return SuggestFieldNotify;
+			}
+
+			return {};
+		}
+
+		if (Node->IsA<UMDFastBindingValue_Function>())
+		{
+			return {};
+		}
+
+		// Other nodes only transform their inputs, so they don't need to poll if their inputs don't
+		bool bHasInputs = false;
+		for (const FMDFastBindingItem& Item : Node->GetBindingItems())
+		{
+			if (Item.Value != nullptr)
+			{
+				if (DoesNodeTick(Item.Value))
+				{
+					return {};
+				}
+
+				bHasInputs = true;
+			}
+		}
+
+		return bHasInputs ? SuggestIfUpdatesNeeded : FString();
+	}
+
+	// Rough size of what a widget instance allocates for this node: the object, its binding items and its cached value
+	int64 EstimateNodeBytes(UMDFastBindingObject* Node)
+	{
+		int64 Bytes = Node->GetClass()->GetStructureSize() + Node->GetBindingItems().GetAllocatedSize();
+		if (UMDFastBindingValueBase* Value = Cast<UMDFastBindingValueBase>(Node))
+		{
+			if (const FProperty* OutputProp = Value->GetOutputProperty())
+			{
+				Bytes += OutputProp->GetSize();
+			}
+		}
+
+		return Bytes;
+	}
+
+	void GatherActiveNodes(UMDFastBindingObject* Node, TArray<UMDFastBindingObject*>& OutNodes)
+	{
+		if (Node != nullptr)
+		{
+			OutNodes.Add(Node);
+			for (const FMDFastBindingItem& Item : Node->GetBindingItems())
+			{
+				GatherActiveNodes(Item.Value, OutNodes);
+			}
+		}
+	}
+
+	TSharedRef<FJsonObject> AuditBindingContainer(const UWidgetBlueprint& WidgetBP, const UMDFastBindingContainer& BindingContainer, FAuditTotals& InOutTotals)
+	{
+		TSharedRef<FJsonObject> ClassJson = MakeShared<FJsonObject>();
+		ClassJson->SetStringField(TEXT("Blueprint"), WidgetBP.GetPathName());
+
+		TMap<FString, int32> NodeTypeCounts;
+		TArray<TSharedPtr<FJsonValue>> SuggestionsJson;
+		TArray<TSharedPtr<FJsonValue>> InvalidBindingsJson;
+		int32 NumTickingBindings = 0;
+		double MicrosecondsPerFrame = 0.0;
+		int64 BytesPerInstance = BindingContainer.GetClass()->GetStructureSize() + BindingContainer.GetBindings().GetAllocatedSize();
+
+		for (UMDFastBindingInstance* Binding : BindingContainer.GetBindings())
+		{
+			if (Binding == nullptr)
+			{
+				continue;
+			}
+
+			const FString BindingName = Binding->GetBindingDisplayName().ToString();
+			BytesPerInstance += Binding->GetClass()->GetStructureSize();
+
+			const FMDFastBindingCostEstimate Cost = Binding->EstimateCost();
+			MicrosecondsPerFrame += Cost.GetMicrosecondsPerFrame();
+			if (Cost.bTicks)
+			{
+				++NumTickingBindings;
+			}
+
+			TArray<FText> ValidationErrors;
+			if (Binding->IsDataValid(ValidationErrors) == EDataValidationResult::Invalid)
+			{
+				TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+				for (const FText& Error : ValidationErrors)
+				{
+					ErrorsJson.Add(MakeShared<FJsonValueString>(Error.ToString()));
+				}
+
+				TSharedRef<FJsonObject> InvalidBindingJson = MakeShared<FJsonObject>();
+				InvalidBindingJson->SetStringField(TEXT("Binding"), BindingName);
+				InvalidBindingJson->SetArrayField(TEXT("Errors"), ErrorsJson);
+				InvalidBindingsJson.Add(MakeShared<FJsonValueObject>(InvalidBindingJson));
+			}
+
+			TArray<UMDFastBindingObject*> Nodes;
+			GatherActiveNodes(Binding->GetBindingDestination(), Nodes);
+			for (UMDFastBindingObject* Node : Nodes)
+			{
+				++NodeTypeCounts.FindOrAdd(Node->GetClass()->GetName());
+				BytesPerInstance += EstimateNodeBytes(Node);
+
+				if (Node->GetUpdateType() != EMDFastBindingUpdateType::Always)
+				{
+					continue;
+				}
+
+				const FString Suggestion = GetUpdateTypeSuggestion(Node);
+				if (!Suggestion.IsEmpty())
+				{
+					TSharedRef<FJsonObject> SuggestionJson = MakeShared<FJsonObject>();
+					SuggestionJson->SetStringField(TEXT("Binding"), BindingName);
+					SuggestionJson->SetStringField(TEXT("Node"), Node->GetDisplayName().ToString());
+					SuggestionJson->SetStringField(TEXT("Suggestion"), Suggestion);
+					SuggestionsJson.Add(MakeShared<FJsonValueObject>(SuggestionJson));
+				}
+			}
+		}
+
+		NodeTypeCounts.ValueSort(TGreater<int32>());
+		TSharedRef<FJsonObject> NodeTypesJson = MakeShared<FJsonObject>();
+		for (const TPair<FString, int32>& Pair : NodeTypeCounts)
+		{
+			NodeTypesJson->SetNumberField(Pair.Key, Pair.Value);
+		}
+
+		ClassJson->SetNumberField(TEXT("BindingCount"), BindingContainer.GetBindings().Num());
+		ClassJson->SetNumberField(TEXT("TickingBindingCount"), NumTickingBindings);
+		ClassJson->SetNumberField(TEXT("EstimatedMicrosecondsPerFrame"), MicrosecondsPerFrame);
+		ClassJson->SetNumberField(TEXT("EstimatedBytesPerInstance"), BytesPerInstance);
+		ClassJson->SetObjectField(TEXT("NodeTypes"), NodeTypesJson);
+		ClassJson->SetArrayField(TEXT("UpdateTypeSuggestions"), SuggestionsJson);
+		ClassJson->SetArrayField(TEXT("InvalidBindings"), InvalidBindingsJson);
+
+		++InOutTotals.NumBlueprints;
+		InOutTotals.NumBindings += BindingContainer.GetBindings().Num();
+		InOutTotals.NumTickingBindings += NumTickingBindings;
+		InOutTotals.NumInvalidBindings += InvalidBindingsJson.Num();
+		InOutTotals.NumSuggestions += SuggestionsJson.Num();
+
+		return ClassJson;
+	}
+}
+
+UMDFastBindingAuditCommandlet::UMDFastBindingAuditCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMDFastBindingAuditCommandlet::Main(const FString& Params)
+{
+	using namespace MDFastBindingAuditCommandlet_Private;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	FString OutputPath = ParamValues.FindRef(TEXT("Output"));
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("MDFastBinding") / TEXT("BindingAudit.json");
+	}
+
+	const FString PackagePath = ParamValues.FindRef(TEXT("Path"));
+	const bool bFailOnInvalid = Switches.Contains(TEXT("FailOnInvalid"));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	if (!PackagePath.IsEmpty())
+	{
+		Filter.PackagePaths.Add(*PackagePath);
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	UE_LOG(LogMDFastBindingAudit, Display, TEXT("Auditing fast bindings in %d widget blueprints"), Assets.Num());
+
+	FAuditTotals Totals;
+	TArray<TSharedPtr<FJsonValue>> ClassesJson;
+	for (int32 i = 0; i < Assets.Num(); ++i)
+	{
+		if (const UWidgetBlueprint* WidgetBP = Cast<UWidgetBlueprint>(Assets[i].GetAsset()))
+		{
+			const UMDFastBindingWidgetBlueprintExtension* Extension = UMDFastBindingWidgetBlueprintExtension::GetExtension<UMDFastBindingWidgetBlueprintExtension>(WidgetBP);
+			const UMDFastBindingContainer* BindingContainer = Extension != nullptr ? Extension->GetBindingContainer() : nullptr;
+			if (BindingContainer != nullptr && BindingContainer->GetBindings().Num() > 0)
+			{
+				ClassesJson.Add(MakeShared<FJsonValueObject>(AuditBindingContainer(*WidgetBP, *BindingContainer, Totals)));
+			}
+		}
+		else
+		{
+			UE_LOG(LogMDFastBindingAudit, Warning, TEXT("Failed to load [%s]"), *Assets[i].GetObjectPathString());
+		}
+
+		if ((i + 1) % NumBlueprintsPerGC == 0)
+		{
+			UE_LOG(LogMDFastBindingAudit, Display, TEXT("Audited %d/%d widget blueprints"), i + 1, Assets.Num());
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	TSharedRef<FJsonObject> TotalsJson = MakeShared<FJsonObject>();
+	TotalsJson->SetNumberField(TEXT("BlueprintCount"), Totals.NumBlueprints);
+	TotalsJson->SetNumberField(TEXT("BindingCount"), Totals.NumBindings);
+	TotalsJson->SetNumberField(TEXT("TickingBindingCount"), Totals.NumTickingBindings);
+	TotalsJson->SetNumberField(TEXT("InvalidBindingCount"), Totals.NumInvalidBindings);
+	TotalsJson->SetNumberField(TEXT("UpdateTypeSuggestionCount"), Totals.NumSuggestions);
+
+	TSharedRef<FJsonObject> ReportJson = MakeShared<FJsonObject>();
+	ReportJson->SetObjectField(TEXT("Totals"), TotalsJson);
+	ReportJson->SetArrayField(TEXT("Classes"), ClassesJson);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	if (!FJsonSerializer::Serialize(ReportJson, Writer) || !FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+	{
+		UE_LOG(LogMDFastBindingAudit, Error, TEXT("Failed to write binding audit report to [%s]"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogMDFastBindingAudit, Display, TEXT("Wrote binding audit report to [%s]: %d blueprints, %d bindings, %d ticking, %d invalid, %d update type suggestions")
+		, *OutputPath, Totals.NumBlueprints, Totals.NumBindings, Totals.NumTickingBindings, Totals.NumInvalidBindings, Totals.NumSuggestions);
+
+	return bFailOnInvalid && Totals.NumInvalidBindings > 0 ? 1 : 0;
+}
@@ -12,6 +12,7 @@
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "MDFastBindingContainer.h"
+#include "MDFastBindingCostEstimate.h"
 #include "MDFastBindingEditorStyle.h"
 #include "MDFastBindingInstance.h"
 #include "Misc/DataValidation.h"
@@ -184,6 +185,7 @@ namespace MDFastBindingPropertyBinding
 		WidgetNode->SetUpdateType(EMDFastBindingUpdateType::Once);
 		WidgetNode->SetFieldPath({ WidgetBlueprint->GeneratedClass->FindPropertyByName(Widget->GetFName()) });
 		WidgetNode->BindingObjectIdentifier = FGuid::NewGuid();
+		Binding->MarkStructureChanged();
 
 		NotifyBindingsChanged(const_cast<UWidgetBlueprint*>(WidgetBlueprint));
 		OpenBinding(const_cast<UWidgetBlueprint*>(WidgetBlueprint), Binding);
@@ -217,9 +219,10 @@ namespace MDFastBindingPropertyBinding
 
 		if (UMDFastBindingInstance* Binding = FindBindingInstance(WidgetBlueprint, Widget, Property))
 		{
+			const FMDFastBindingCostEstimate Cost = Binding->EstimateCost();
 			MenuBuilder.AddMenuEntry(
-				INVTEXT("Show in Binding Editor"),
-				FText::Format(INVTEXT("Open the Binding Editor to the binding that binds to {0}."), Property->GetDisplayNameText()),
+				FText::Format(INVTEXT("Show in Binding Editor ({0})"), Cost.GetSummaryText()),
+				FText::Format(INVTEXT("Open the Binding Editor to the binding that binds to {0}.\n\n{1}"), Property->GetDisplayNameText(), Cost.GetBreakdownText()),
 				FSlateIcon(FMDFastBindingEditorStyle::GetStyleSetName(), "Icon.FastBinding_16x"),
 				FUIAction(FExecuteAction::CreateStatic(&OpenBinding, const_cast<UWidgetBlueprint*>(WidgetBlueprint), Binding))
 			);
@@ -53,6 +53,17 @@ void FMDFastBindingDesignerExtension::Uninitialize()
 
 void FMDFastBindingDesignerExtension::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
+	// A pass that ran out of budget continues on the next tick, new passes wait for the update interval
+	if (NextContainerToUpdate == 0)
+	{
+		if (InCurrentTime - LastUpdatePassTime < GetDefault<UMDFastBindingEditorConfig>()->GetDesignTimeUpdateInterval())
+		{
+			return;
+		}
+
+		LastUpdatePassTime = InCurrentTime;
+	}
+
 	UpdateBindingInstances();
 }
 
@@ -74,7 +85,7 @@ void FMDFastBindingDesignerExtension::PreviewContentChanged(TSharedRef<SWidget>
 void FMDFastBindingDesignerExtension::InitializeBindingInstances()
 {
 	TerminateBindingInstances();
-	
+
 	if (!GetDefault<UMDFastBindingEditorConfig>()->ShouldRunBindingsAtDesignTime())
 	{
 		return;
@@ -89,39 +100,57 @@ void FMDFastBindingDesignerExtension::InitializeBindingInstances()
 
 void FMDFastBindingDesignerExtension::UpdateBindingInstances()
 {
-	for (auto It = BindingContainers.CreateIterator(); It; ++It)
+	if (NextContainerToUpdate == 0)
 	{
-		if (UUserWidget* BindingOwner = It.Key().Get())
+		BindingContainers.RemoveAll([](const FDesignTimeContainer& Entry)
 		{
-			for (const TStrongObjectPtr<UMDFastBindingContainer>& BindingContainer : It.Value())
-			{
-				BindingContainer->UpdateBindings(BindingOwner);
-			}
+			return !Entry.Owner.IsValid() || !Entry.Container.IsValid();
+		});
+	}
+
+	const double BudgetSeconds = GetDefault<UMDFastBindingEditorConfig>()->GetDesignTimeUpdateBudgetSeconds();
+	const double StartTime = FPlatformTime::Seconds();
+
+	while (NextContainerToUpdate < BindingContainers.Num())
+	{
+		const FDesignTimeContainer& Entry = BindingContainers[NextContainerToUpdate++];
+
+		// Containers without ticking bindings are waiting on events, and ticking bindings skip nodes whose inputs haven't changed
+		UUserWidget* BindingOwner = Entry.Owner.Get();
+		if (BindingOwner != nullptr && Entry.Container.IsValid() && Entry.Container->DoesNeedTick())
+		{
+			Entry.Container->UpdateBindings(BindingOwner);
 		}
-		else
+
+		if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
 		{
-			It.Value().Reset();
-			It.RemoveCurrent();
+			break;
 		}
 	}
+
+	if (NextContainerToUpdate >= BindingContainers.Num())
+	{
+		NextContainerToUpdate = 0;
+	}
 }
 
 void FMDFastBindingDesignerExtension::TerminateBindingInstances()
 {
-	for (auto It = BindingContainers.CreateIterator(); It; ++It)
+	for (FDesignTimeContainer& Entry : BindingContainers)
 	{
-		if (UUserWidget* BindingOwner = It.Key().Get())
+		if (UUserWidget* BindingOwner = Entry.Owner.Get())
 		{
-			for (const TStrongObjectPtr<UMDFastBindingContainer>& BindingContainer : It.Value())
+			if (Entry.Container.IsValid())
 			{
-				BindingContainer->TerminateBindings(BindingOwner);
+				Entry.Container->TerminateBindings(BindingOwner);
 			}
 		}
-		
-		It.Value().Reset();
+
+		Entry.Container.Reset();
 	}
 
 	BindingContainers.Reset();
+	NextContainerToUpdate = 0;
 }
 
 void FMDFastBindingDesignerExtension::InitializeBindingInstanceForWidget(UUserWidget* Widget)
@@ -140,13 +169,15 @@ void FMDFastBindingDesignerExtension::InitializeBindingInstanceForWidget(UUserWi
 			bDoesHaveExtensionBinding = Extension->HasBindings();
 		}
 		
+		// Destinations set by more derived classes, which override super class bindings that set them
+		TSet<FString> DestinationKeys;
 		while (BPClass != nullptr)
 		{
-			BPClass->ForEachExtension([this, Widget](UWidgetBlueprintGeneratedClassExtension* Extension)
+			BPClass->ForEachExtension([this, Widget, &DestinationKeys](UWidgetBlueprintGeneratedClassExtension* Extension)
 			{
 				if (const UMDFastBindingWidgetClassExtension* SuperClassExtension = Cast<UMDFastBindingWidgetClassExtension>(Extension))
 				{
-					InitializeBindingContainerForWidget(SuperClassExtension->GetBindingContainer(), Widget);
+					InitializeBindingContainerForWidget(SuperClassExtension->GetBindingContainer(), Widget, DestinationKeys);
 				}
 			});
 			BPClass = Cast<UWidgetBlueprintGeneratedClass>(BPClass->GetSuperClass());
@@ -158,7 +189,8 @@ void FMDFastBindingDesignerExtension::InitializeBindingInstanceForWidget(UUserWi
 	{
 		if (const UMDFastBindingContainer* LegacyBindingContainer = MDFastBindingEditorHelpers::FindBindingContainerCDOInClass(Widget->GetClass()))
 		{
-			InitializeBindingContainerForWidget(LegacyBindingContainer, Widget);
+			TSet<FString> DestinationKeys;
+			InitializeBindingContainerForWidget(LegacyBindingContainer, Widget, DestinationKeys);
 		}
 	}
 		
@@ -174,12 +206,30 @@ void FMDFastBindingDesignerExtension::InitializeBindingInstanceForWidget(UUserWi
 	}
 }
 
-void FMDFastBindingDesignerExtension::InitializeBindingContainerForWidget(const UMDFastBindingContainer* CDOBindingContainer, UUserWidget* Widget)
+void FMDFastBindingDesignerExtension::InitializeBindingContainerForWidget(const UMDFastBindingContainer* CDOBindingContainer, UUserWidget* Widget, TSet<FString>& InOutDestinationKeys)
 {
+	if (CDOBindingContainer == nullptr)
+	{
+		return;
+	}
+
+	if (BindingContainers.ContainsByPredicate([CDOBindingContainer, Widget](const FDesignTimeContainer& Entry)
+	{
+		return Entry.Owner.Get() == Widget && Entry.SourceContainer.Get() == CDOBindingContainer;
+	}))
+	{
+		return;
+	}
+
 	if (UMDFastBindingContainer* BindingContainer = DuplicateObject<UMDFastBindingContainer>(CDOBindingContainer, Widget))
 	{
+		BindingContainer->RemoveOverriddenBindings(InOutDestinationKeys);
 		BindingContainer->InitializeBindings(Widget);
-		BindingContainers.FindOrAdd(Widget).AddUnique(TStrongObjectPtr<UMDFastBindingContainer>(BindingContainer));
+
+		FDesignTimeContainer& Entry = BindingContainers.AddDefaulted_GetRef();
+		Entry.Owner = Widget;
+		Entry.SourceContainer = CDOBindingContainer;
+		Entry.Container.Reset(BindingContainer);
 	}
 }
 
@@ -186,7 +186,7 @@ void SMDFastBindingEditorWidget::Construct(const FArguments&, const TWeakPtr<FBl
 	AssignBindingData(Blueprint);
 	Blueprint->OnCompiled().AddSP(this, &SMDFastBindingEditorWidget::OnBlueprintCompiled);
 	Blueprint->OnSetObjectBeingDebugged().AddSP(this, &SMDFastBindingEditorWidget::UpdateBindingBeingDebugged);
-
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &SMDFastBindingEditorWidget::OnObjectPropertyChanged);
 
 	BindingListView = SNew(SListView<TWeakObjectPtr<UMDFastBindingInstance>>)
 		.ListItemsSource(&Bindings)
@@ -361,6 +361,71 @@ void SMDFastBindingEditorWidget::RefreshGraph() const
 	}
 }
 
+const FMDFastBindingCostEstimate* SMDFastBindingEditorWidget::GetBindingCost(const UMDFastBindingInstance* Binding, int32& OutRank) const
+{
+	if (const FBindingCost* BindingCost = BindingCosts.Find(Binding))
+	{
+		OutRank = BindingCost->Rank;
+		return &BindingCost->Cost;
+	}
+
+	OutRank = INDEX_NONE;
+	return nullptr;
+}
+
+void SMDFastBindingEditorWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Changes are collected and estimated once per frame
+	if (bAreBindingCostsDirty)
+	{
+		RefreshBindingCosts();
+	}
+}
+
+void SMDFastBindingEditorWidget::RefreshBindingCosts()
+{
+	bAreBindingCostsDirty = false;
+	BindingCosts.Reset();
+
+	TArray<TPair<const UMDFastBindingInstance*, double>> TickingCosts;
+	for (const TWeakObjectPtr<UMDFastBindingInstance>& WeakBinding : Bindings)
+	{
+		if (const UMDFastBindingInstance* Binding = WeakBinding.Get())
+		{
+			FBindingCost& BindingCost = BindingCosts.Add(Binding);
+			BindingCost.Cost = Binding->EstimateCost();
+			if (BindingCost.Cost.bTicks)
+			{
+				TickingCosts.Emplace(Binding, BindingCost.Cost.GetMicrosecondsPerFrame());
+			}
+		}
+	}
+
+	TickingCosts.Sort([](const TPair<const UMDFastBindingInstance*, double>& A, const TPair<const UMDFastBindingInstance*, double>& B)
+	{
+		return A.Value > B.Value;
+	});
+
+	// Bindings that cost the same share a rank
+	for (int32 i = 0; i < TickingCosts.Num(); ++i)
+	{
+		const bool bTiesPrevious = i > 0 && TickingCosts[i].Value == TickingCosts[i - 1].Value;
+		BindingCosts[TickingCosts[i].Key].Rank = bTiesPrevious ? BindingCosts[TickingCosts[i - 1].Key].Rank : i;
+	}
+}
+
+void SMDFastBindingEditorWidget::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	// Graph edits mark the blueprint as modified, details panel edits change the binding objects themselves
+	const UMDFastBindingContainer* Container = GetSelectedBindingContainer();
+	if (Object != nullptr && (Object == GetBlueprint() || (Container != nullptr && Object->IsIn(Container))))
+	{
+		bAreBindingCostsDirty = true;
+	}
+}
+
 void SMDFastBindingEditorWidget::AssignBindingData(UBlueprint* BindingOwnerBP)
 {
 	BindingContainer.Reset();
@@ -531,6 +596,8 @@ void SMDFastBindingEditorWidget::PopulateBindingsList()
 		BindingListView->RequestListRefresh();
 	}
 
+	bAreBindingCostsDirty = true;
+
 	if (!SelectedBinding.IsValid() || !Bindings.Contains(SelectedBinding))
 	{
 		if (Bindings.Num() > 0)
@@ -679,6 +746,7 @@ FReply SMDFastBindingEditorWidget::OnDeleteBinding(TWeakObjectPtr<UMDFastBinding
 void SMDFastBindingEditorWidget::OnDetailsPanelPropertyChanged(const FPropertyChangedEvent& Event)
 {
 	RefreshGraph();
+	bAreBindingCostsDirty = true;
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
 }
@@ -736,7 +804,7 @@ FReply SMDFastBindingEditorWidget::OnClearWatches()
 {
 	if (const UMDFastBindingInstance* Binding = GetSelectedBinding())
 	{
-		for (const UMDFastBindingObject* Object : Binding->GatherAllBindingObjects())
+		for (const UMDFastBindingObject* Object : Binding->GetAllBindingObjects())
 		{
 			if (Object != nullptr)
 			{
@@ -6,11 +6,18 @@
 #include "MDFastBindingInstance.h"
 #include "ScopedTransaction.h"
 #include "SMDFastBindingEditorWidget.h"
+#include "Styling/StyleColors.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Text/SInlineEditableTextBlock.h"
 
 #define LOCTEXT_NAMESPACE "MDFastbindingInstanceRow"
 
+namespace SMDFastBindingInstanceRow_Private
+{
+	// The most expensive ticking bindings in a widget are highlighted
+	constexpr int32 NumTopOffenders = 3;
+}
+
 class SMDFastBindingInstanceRowHandle : public SCompoundWidget
 {
 public:
@@ -188,6 +195,18 @@ void SMDFastBindingInstanceRow::Construct(const FArguments& InArgs, TSharedRef<S
 				+SHorizontalBox::Slot()
 				.VAlign(VAlign_Center)
 				.HAlign(HAlign_Fill)
+				.AutoWidth()
+				.Padding(0.f, 0.f, 4.f, 0.f)
+				[
+					SNew(STextBlock)
+					.Font(FAppStyle::GetFontStyle("SmallFont"))
+					.ToolTipText(this, &SMDFastBindingInstanceRow::GetBindingPerformanceTooltip)
+					.Text(this, &SMDFastBindingInstanceRow::GetBindingCostText)
+					.ColorAndOpacity(this, &SMDFastBindingInstanceRow::GetBindingCostColor)
+				]
+				+SHorizontalBox::Slot()
+				.VAlign(VAlign_Center)
+				.HAlign(HAlign_Fill)
 				.FillWidth(1.f)
 				[
 					SAssignNew(TitleText, SInlineEditableTextBlock)
@@ -307,16 +326,17 @@ const FSlateBrush* SMDFastBindingInstanceRow::GetBindingValidationBrush() const
 
 FText SMDFastBindingInstanceRow::GetBindingPerformanceTooltip() const
 {
-	if (const UMDFastBindingInstance* BindingPtr = CachedBindingPtr.Get())
+	int32 CostRank = INDEX_NONE;
+	if (const FMDFastBindingCostEstimate* Cost = GetBindingCost(CostRank))
 	{
-		if (BindingPtr->IsBindingPerformant())
-		{
-			return LOCTEXT("PerformantBindingTooltip", "This binding does not run every tick");
-		}
-		else
+		if (IsTopOffender())
 		{
-			return LOCTEXT("PerformantBindingTooltip", "This binding is evaluated every tick");
+			return FText::Format(LOCTEXT("TopOffenderBindingTooltip", "This is one of the {0} most expensive bindings that tick in this widget\n\n{1}")
+				, SMDFastBindingInstanceRow_Private::NumTopOffenders
+				, Cost->GetBreakdownText());
 		}
+
+		return Cost->GetBreakdownText();
 	}
 
 	return FText::GetEmpty();
@@ -339,6 +359,39 @@ const FSlateBrush* SMDFastBindingInstanceRow::GetBindingPerformanceBrush() const
 	return nullptr;
 }
 
+const FMDFastBindingCostEstimate* SMDFastBindingInstanceRow::GetBindingCost(int32& OutRank) const
+{
+	OutRank = INDEX_NONE;
+
+	const TSharedPtr<SMDFastBindingEditorWidget> EditorWidget = CachedEditorWidget.Pin();
+	const UMDFastBindingInstance* BindingPtr = CachedBindingPtr.Get();
+	if (EditorWidget.IsValid() && BindingPtr != nullptr)
+	{
+		return EditorWidget->GetBindingCost(BindingPtr, OutRank);
+	}
+
+	return nullptr;
+}
+
+bool SMDFastBindingInstanceRow::IsTopOffender() const
+{
+	int32 CostRank = INDEX_NONE;
+	GetBindingCost(CostRank);
+	return CostRank != INDEX_NONE && CostRank < SMDFastBindingInstanceRow_Private::NumTopOffenders;
+}
+
+FText SMDFastBindingInstanceRow::GetBindingCostText() const
+{
+	int32 CostRank = INDEX_NONE;
+	const FMDFastBindingCostEstimate* Cost = GetBindingCost(CostRank);
+	return Cost != nullptr ? Cost->GetSummaryText() : FText::GetEmpty();
+}
+
+FSlateColor SMDFastBindingInstanceRow::GetBindingCostColor() const
+{
+	return IsTopOffender() ? FStyleColors::Warning : FSlateColor::UseSubduedForeground();
+}
+
 const FSlateBrush* SMDFastBindingInstanceRow::GetBorder() const
 {
 	if (CachedEditorWidget.Pin().IsValid() && CachedEditorWidget.Pin()->GetSelectedBinding() == CachedBindingPtr)
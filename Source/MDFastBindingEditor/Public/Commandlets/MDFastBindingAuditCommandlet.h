@@ -0,0 +1,25 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "MDFastBindingAuditCommandlet.generated.h"
+
+/**
+ * Loads every widget blueprint that has fast bindings and writes a JSON report of their bindings
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=MDFastBindingAudit [-Output=<File>] [-Path=<PackagePath>] [-FailOnInvalid]
+ *	-Output: Where to write the report, defaults to Saved/MDFastBinding/BindingAudit.json
+ *	-Path: Only audit widget blueprints under this package path (eg. /Game/UI)
+ *	-FailOnInvalid: Return a non-zero exit code if any binding fails validation
+ */
+UCLASS()
+class MDFASTBINDINGEDITOR_API UMDFastBindingAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMDFastBindingAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
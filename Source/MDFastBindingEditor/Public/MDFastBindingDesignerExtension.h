@@ -25,18 +25,30 @@ public:
 	virtual void PreviewContentChanged(TSharedRef<SWidget> NewContent) override;
 
 private:
+	struct FDesignTimeContainer
+	{
+		TWeakObjectPtr<UUserWidget> Owner;
+		// The class level container this was duplicated from
+		TWeakObjectPtr<const UMDFastBindingContainer> SourceContainer;
+		TStrongObjectPtr<UMDFastBindingContainer> Container;
+	};
+
 	void InitializeBindingInstances();
 	void UpdateBindingInstances();
 	void TerminateBindingInstances();
 
 	void InitializeBindingInstanceForWidget(UUserWidget* Widget);
-	void InitializeBindingContainerForWidget(const UMDFastBindingContainer* CDOBindingContainer, UUserWidget* Widget);
+	void InitializeBindingContainerForWidget(const UMDFastBindingContainer* CDOBindingContainer, UUserWidget* Widget, TSet<FString>& InOutDestinationKeys);
 
 	void OnShouldRunBindingsAtDesignTimeChanged();
 
 	UUserWidget* GetPreviewWidget() const;
 	FWidgetBlueprintEditor* FindWidgetEditor() const;
 
-	TMap<TWeakObjectPtr<UUserWidget>, TArray<TStrongObjectPtr<UMDFastBindingContainer>>> BindingContainers;
+	TArray<FDesignTimeContainer> BindingContainers;
+
+	// Index of the next container to update, non-zero while an update pass is spread across frames by the time budget
+	int32 NextContainerToUpdate = 0;
+	double LastUpdatePassTime = 0.0;
 	TWeakObjectPtr<UUserWidget> PreviewedWidget = nullptr;
 };
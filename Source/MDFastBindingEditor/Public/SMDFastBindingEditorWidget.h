@@ -4,6 +4,7 @@
 
 #include "WorkflowOrientedApp/WorkflowTabFactory.h"
 #include "EditorUndoClient.h"
+#include "MDFastBindingCostEstimate.h"
 #include "UObject/WeakFieldPtr.h"
 #include "Widgets/Views/SListView.h"
 
@@ -47,7 +48,22 @@ public:
 
 	void RefreshGraph() const;
 
+	// Returns the cost estimate of a binding in the selected container, OutRank is how many ticking bindings cost more per frame (INDEX_NONE if it doesn't tick)
+	const FMDFastBindingCostEstimate* GetBindingCost(const UMDFastBindingInstance* Binding, int32& OutRank) const;
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
 private:
+	struct FBindingCost
+	{
+		FMDFastBindingCostEstimate Cost;
+		int32 Rank = INDEX_NONE;
+	};
+
+	// Estimates and ranks every binding in the container once, rows read their cost from here
+	void RefreshBindingCosts();
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+
 	void OnGraphSelectionChanged(const FGraphPanelSelectionSet& Selection);
 	void OnBindingsExternallyModified();
 
@@ -84,6 +100,9 @@ private:
 	TSharedPtr<SListView<TWeakObjectPtr<UMDFastBindingInstance>>> BindingListView;
 	TSharedPtr<SMDFastBindingEditorGraphWidget> BindingGraphWidget;
 	TSharedPtr<SMDFastBindingWatchList> WatchList;
+
+	TMap<TWeakObjectPtr<const UMDFastBindingInstance>, FBindingCost> BindingCosts;
+	bool bAreBindingCostsDirty = true;
 };
 
 struct FMDFastBindingEditorSummoner : public FWorkflowTabFactory
@@ -9,6 +9,7 @@
 class SInlineEditableTextBlock;
 class SMDFastBindingEditorWidget;
 class UMDFastBindingInstance;
+struct FMDFastBindingCostEstimate;
 
 class FMDFastBindingInstanceRowDragDropOp : public FDecoratedDragDropOp
 {
@@ -60,6 +61,12 @@ private:
 	FText GetBindingPerformanceTooltip() const;
 	const FSlateBrush* GetBindingPerformanceBrush() const;
 
+	// The editor widget estimates and ranks the container's bindings together
+	const FMDFastBindingCostEstimate* GetBindingCost(int32& OutRank) const;
+	bool IsTopOffender() const;
+	FText GetBindingCostText() const;
+	FSlateColor GetBindingCostColor() const;
+
 	const FSlateBrush* GetBorder() const;
 
 	EVisibility GetHandleVisibility() const;
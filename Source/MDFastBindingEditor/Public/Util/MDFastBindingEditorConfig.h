@@ -18,6 +18,9 @@ public:
 	bool ShouldRunBindingsAtDesignTime() const { return bShouldRunBindingsAtDesignTime; }
 	void ToggleShouldRunBindingsAtDesignTime();
 
+	double GetDesignTimeUpdateInterval() const { return DesignTimeUpdateRate > 0.f ? 1.0 / DesignTimeUpdateRate : 0.0; }
+	double GetDesignTimeUpdateBudgetSeconds() const { return DesignTimeUpdateBudgetMs / 1000.0; }
+
 	mutable FSimpleMulticastDelegate OnShouldRunBindingsAtDesignTimeChanged;
 
 #if WITH_EDITOR
@@ -30,4 +33,13 @@ protected:
 	// or for bindings that interact with Widget Animations
 	UPROPERTY(EditDefaultsOnly, Config, Category = "UMG")
 	bool bShouldRunBindingsAtDesignTime = false;
+
+	// How many times per second design-time bindings update in the designer preview, 0 updates them every editor frame
+	UPROPERTY(EditDefaultsOnly, Config, Category = "UMG", meta = (ClampMin = "0", UIMin = "0", UIMax = "60", EditCondition = "bShouldRunBindingsAtDesignTime"))
+	float DesignTimeUpdateRate = 15.f;
+
+	// Maximum time in milliseconds spent updating design-time bindings per editor frame,
+	// containers that don't fit in the budget are updated on the following frames. 0 is unlimited
+	UPROPERTY(EditDefaultsOnly, Config, Category = "UMG", meta = (ClampMin = "0", Units = "ms", EditCondition = "bShouldRunBindingsAtDesignTime"))
+	float DesignTimeUpdateBudgetMs = 2.f;
 };